@@ -5,7 +5,7 @@
 // 4. Освободить память, выделенную под массив
 
 #include <iostream>     // Для работы с вводом/выводом (cout, cin, endl)
-#include <random>       // Для генерации случайных чисел (random_device, mt19937, uniform_int_distribution)      
+#include "../Common/data_generator.h"  // Параллельная генерация массивов (счётчиковый генератор)
 using namespace std;    // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
 
 int main() {            // Основная функция
@@ -16,19 +16,10 @@ int main() {            // Основная функция
                                   // new int[SIZE] - выделяем память   
                                   // Создаём динамический массив типа int с размером SIZE (50000)
 
-    // Настройка генератора случайных чисел
-    random_device rd;                  // random_device используется как источник случайности
-    mt19937 gen(rd());                 // mt19937 — генератор случайных чисел Mersenne Twister
-                                       // Инициализируем его значением из rd(), чтобы последовательность была случайной
-    
-    uniform_int_distribution<int> dist(1, 100);    // uniform_int_distribution задаёт равномерное распределение чисел от 1 до 100
-                                                   // dist(gen) будет возвращать случайное число из этого диапазона
-
-
-    // Заполнение массива случайными числами
-    for (int i = 0; i < SIZE; ++i) {  // ++i используется для увеличения i перед следующей итерацией (префиксный инкремент)
-               arr[i] = dist(gen);    // Для каждого индекса i от 0 до SIZE-1 генерируем случайное число dist(gen) и записываем его в массив 
-    }
+    // Заполнение массива случайными числами (Common/data_generator.h)
+    generateArray(arr, SIZE, Distribution::Uniform, 1, 100); // Равномерное распределение чисел от 1 до 100
+                                                             // Потоки заполняют свои куски независимо, зерно фиксировано —
+                                                             // массив одинаков в каждом запуске и при любом числе потоков
 
     
     // Вывод первых 100 элементов массива
@@ -5,9 +5,10 @@
 // 3. Замерить время выполнения алгоритма
 
 #include <iostream>     // Для работы с вводом/выводом (cout, cin, endl)
-#include <random>       // Для генерации случайных чисел (random_device, mt19937, uniform_int_distribution)
 #include <chrono>       // Для измерения времени выполнения
 #include <omp.h>        // Для OpenMP (параллельные вычисления) для 3 задание
+#include "../Common/reduction.h"   // Общая библиотека параллельных редукций (min/max/sum за один проход)
+#include "../Common/data_generator.h"  // Параллельная генерация массивов (счётчиковый генератор)
 using namespace std;    // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
 
 int main() {            // Основная функция
@@ -18,19 +19,10 @@ int main() {            // Основная функция
                                      // new int[SIZE] - выделяем память   
                                      // Создаём динамический массив типа int с размером SIZE (1000000)
 
-    // Настройка генератора случайных чисел
-    random_device rd;                  // random_device используется как источник случайности
-    mt19937 gen(rd());                 // mt19937 — генератор случайных чисел Mersenne Twister
-                                       // Инициализируем его значением из rd(), чтобы последовательность была случайной
-    
-    uniform_int_distribution<int> dist(1, 1000000);   // uniform_int_distribution задаёт равномерное распределение чисел от 1 до 1000000 (можно изменить)
-                                                      // dist(gen) будет возвращать случайное число из этого диапазона
-
-    
-    // Заполнение массива случайными числами
-    for (int i = 0; i < SIZE; ++i) {   // ++i используется для увеличения i перед следующей итерацией (префиксный инкремент)
-        arr[i] = dist(gen);            // Для каждого индекса i от 0 до SIZE-1 генерируем случайное число dist(gen) и записываем его в массив 
-    }
+    // Заполнение массива случайными числами (Common/data_generator.h)
+    generateArray(arr, SIZE, Distribution::Uniform, 1, 1000000); // Равномерное распределение чисел от 1 до 1000000
+                                                                 // Потоки заполняют свои куски независимо, зерно фиксировано —
+                                                                 // массив одинаков в каждом запуске и при любом числе потоков
 
     
     // Вывод первых 100 элементов массива
@@ -78,27 +70,14 @@ int main() {            // Основная функция
     // ПAРАЛЛЕЛЬНЫЙ ПОИСК MIN/MAX
     auto start_time_p = chrono::high_resolution_clock::now();  // Начало замера времени
 
-    int global_min = arr[0];           // Глобальный минимальный элемент массива (для всех потоков)
-    int global_max = arr[0];           // Глобальный максимальный элемент массива (для всех потоков)
-
-    #pragma omp parallel               // Начало параллельного блока
-    {
-        int local_min = arr[0];        // Локальный min для каждого потока
-        int local_max = arr[0];        // Локальный max для каждого потока
+    // Совмещённая редукция из общей библиотеки (Common/reduction.h):
+    //        - каждый поток обходит свой непрерывный кусок массива
+    //        - локальные min/max лежат в отдельных кэш-линиях, critical не нужен
+    //        - частичные результаты сливаются после параллельной области
+    pair<int, int> min_max = parallelMinMax(arr, SIZE);
 
-        #pragma omp for                // Распределяем цикл между потоками
-        for (int i = 1; i < SIZE; ++i) {
-            if (arr[i] < local_min) local_min = arr[i];  // Находим локальный минимум
-            if (arr[i] > local_max) local_max = arr[i];  // Находим локальный максимум
-        }
-
-        
-        #pragma omp critical           // Критическая секция для обновления глобальных значений
-        {                              // После окончания работы каждого потока локальные значения сравниваются с глобальными значениями
-            if (local_min < global_min) global_min = local_min;  // Обновляем глобальный минимум
-            if (local_max > global_max) global_max = local_max;  // Обновляем глобальный максимум
-        }
-    }
+    int global_min = min_max.first;    // Глобальный минимальный элемент массива
+    int global_max = min_max.second;   // Глобальный максимальный элемент массива
 
     auto end_time_p = chrono::high_resolution_clock::now();  // Конец замера времени
 
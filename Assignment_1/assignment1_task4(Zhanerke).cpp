@@ -4,9 +4,10 @@
 // 3. Замерить время выполнения алгоритма
 // 4. Сравнить время обоих реализации
 #include <iostream>     // Для работы с вводом/выводом (cout, cin, endl)
-#include <random>       // Для генерации случайных чисел (random_device, mt19937, uniform_int_distribution)  
 #include <chrono>       // Для измерения времени выполнения
 #include <omp.h>        // Для параллельных вычислений OpenMP
+#include "../Common/statistics.h"  // Общая библиотека: статистика массива за один проход
+#include "../Common/data_generator.h"  // Параллельная генерация массивов (счётчиковый генератор)
 
 using namespace std;    // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
 
@@ -18,18 +19,10 @@ int main() {            // Основная функция
                                           // new int[SIZE] - выделяем память   
                                           // Создаём динамический массив типа int с размером SIZE (5000000)
 
-    // Настройка генератора случайных чисел 
-    random_device rd;                      // random_device используется как источник случайности
-    mt19937 gen(rd());                     // mt19937 — генератор случайных чисел Mersenne Twister
-                                           // Инициализируем его значением из rd(), чтобы последовательность была случайной
-
-    uniform_int_distribution<int> dist(1, 5000000);    // uniform_int_distribution задаёт равномерное распределение чисел от 1 до 5000000
-                                                    // dist(gen) будет возвращать случайное число из этого диапазона
-
-    // Заполнение массива случайными числами
-    for (int i = 0; i < SIZE; ++i) {                // ++i используется для увеличения i перед следующей итерацией (префиксный инкремент)
-        arr[i] = dist(gen);                         // Для каждого индекса i от 0 до SIZE-1 генерируем случайное число dist(gen) и записываем его в массив 
-    }
+    // Заполнение массива случайными числами (Common/data_generator.h)
+    generateArray(arr, SIZE, Distribution::Uniform, 1, 5000000); // Равномерное распределение чисел от 1 до 5000000
+                                                                 // Потоки заполняют свои куски независимо, зерно фиксировано —
+                                                                 // массив одинаков в каждом запуске и при любом числе потоков
 
     // Вывод первых 100 элементов массива
     cout << "Первые 100 элементов массива:\n";      // Выводим заголовок перед числами
@@ -65,18 +58,13 @@ int main() {            // Основная функция
     // ПАРАЛЛЕЛЬНОЕ ВЫЧИСЛЕНИЕ СРЕДНЕГО с OpenMP и reduction
     auto start_par = chrono::high_resolution_clock::now();           // Начало замера времени
 
-    long long sum_par = 0;                                           // Глобальная переменная суммы (будет использоваться в reduction)
-
-    #pragma omp parallel for reduction(+:sum_par)                    // Цикл выполняется в нескольких потоках
-    // OpenMP:
-    //        - массив делится между потоками
-    //        - каждый поток считает свою локальную сумму
-    //        - OpenMP автоматически суммирует результаты
-    for (int i = 0; i < SIZE; ++i) {
-        sum_par += arr[i];                                            // Для каждого элемента массива добавляем его значение к sum_par       
-    }
+    // OpenMP через общую библиотеку (Common/statistics.h):
+    //        - массив делится между потоками на непрерывные куски
+    //        - за один проход по памяти считаются сумма, min, max и дисперсия (AVX2 / AVX-512, если есть)
+    //        - частичные суммы потоков складываются после параллельной области (как reduction(+:sum))
+    Statistics<int> stats_par = parallelStatistics(arr, SIZE);
 
-    double avg_par = static_cast<double>(sum_par) / SIZE;             // Делим сумму на размер массива и получаем среднее значение
+    double avg_par = static_cast<double>(stats_par.sum) / SIZE;       // Среднее из суммы того же прохода, как в последовательной версии
 
     auto end_par = chrono::high_resolution_clock::now();              // Конец замера времени
 
@@ -86,6 +74,8 @@ int main() {            // Основная функция
     // Вывод
     cout << "\nПоследовательное среднее значенние = " << avg_seq << endl;
     cout << "Параллельное среднее значение = " << avg_par << endl;
+    cout << "Минимум = " << stats_par.minValue << ", Максимум = " << stats_par.maxValue   // Остальная статистика того же прохода
+         << ", Дисперсия = " << stats_par.variance() << " (" << simdLevelName(detectSimdLevel()) << ")" << endl;
 
     cout << "\nПродолжительность последовательного вычисление = " << time_seq.count() << " ms" << endl;
     cout << "Продолжительность параллельного вычисление = " << time_par.count() << " ms" << endl;
@@ -8,9 +8,11 @@
 
 #include <iostream>      // Для работы с вводом/выводом (cout, cin, endl)
 #include <vector>        // Для динамического массива vector
-#include <random>        // Для генерации случайных чисел
 #include <omp.h>         // Для работы с OpenMP
 #include <chrono>        // Для измерения времени выполнения
+#include "../Common/reduction.h"  // Общая библиотека параллельных редукций
+#include "../Common/dispatch.h"   // Адаптивный выбор: последовательно или параллельно (калиброванный порог)
+#include "../Common/data_generator.h"  // Параллельная генерация массивов (счётчиковый генератор)
 
 using namespace std;     // Используем стандартное пространство имен
 
@@ -19,18 +21,10 @@ int main() {
     vector<int> arr(SIZE);              // Создание динамического массива из SIZE элементов
 
     
-    // Настройка генератора случайных чисел
-    random_device rd;                  // random_device используется как источник случайности
-    mt19937 gen(rd());                 // mt19937 — генератор случайных чисел Mersenne Twister
-                                       // Инициализируем его значением из rd(), чтобы последовательность была случайной
-    
-    uniform_int_distribution<int> dist(0, 9999);      // uniform_int_distribution задаёт равномерное распределение чисел от 0 до 9999 (можно изменить)
-                                                      // dist(gen) будет возвращать случайное число из этого диапазона
-
-    // Заполнение массива случайными числами
-    for (int i = 0; i < SIZE; ++i) {
-        arr[i] = dist(gen);                           // Генерация случайного числа и запись в массив
-    }
+    // Заполнение массива случайными числами (Common/data_generator.h)
+    generateArray(arr, Distribution::Uniform, 0, 9999); // Равномерное распределение чисел от 0 до 9999
+                                                        // Потоки заполняют свои куски независимо, зерно фиксировано —
+                                                        // массив одинаков в каждом запуске и при любом числе потоков
 
     // Последовательная реализация поиска min и max
     auto start_seq = chrono::high_resolution_clock::now(); // Начало замера времени
@@ -51,21 +45,20 @@ int main() {
 
 
     // Параллельная реализация с OpenMP
+    dispatchThresholds();                              // Пороги читаются из файла (или калибруются) до замера времени
     auto start_par = chrono::high_resolution_clock::now(); // Начала замера времени
 
-    int min_val_par = arr[0];            // Инициализация минимума для параллельной версии
-    int max_val_par = arr[0];            // Инициализация максимума для параллельной версии
-
-    #pragma omp parallel for reduction(min:min_val_par) reduction(max:max_val_par) // Параллельный цикл с редукцией
-    for (int i = 1; i < SIZE; ++i) {                                               // Каждый поток обрабатывает часть массива
-        if (arr[i] < min_val_par) min_val_par = arr[i];                            // Локальный минимум обновляется
-        if (arr[i] > max_val_par) max_val_par = arr[i];                            // Локальный максимум обновляется
-    }
+    pair<int, int> min_max_par = dispatchMinMax(arr); // Совмещённый min/max за один проход (Common/dispatch.h):
+                                                      // порог параллельности найден калибровкой на этой машине,
+                                                      // маленький массив обрабатывается без создания потоков
+    int min_val_par = min_max_par.first;              // Минимум параллельной версии
+    int max_val_par = min_max_par.second;             // Максимум параллельной версии
 
     auto end_par = chrono::high_resolution_clock::now();                           // Конец замера времени
     chrono::duration<double> duration_par = end_par - start_par;                   // Вычисляем длительность
 
     cout << "Параллельная реализация (OpenMP):\n";                                 // Вывод результата
+    cout << "Режим: " << executionModeName(reduceMode(SIZE)) << "\n";              // Какой режим выбрал dispatch
     cout << "Минимум: " << min_val_par << ", Максимум: " << max_val_par << "\n";   // Минимум и максимум
     cout << "Время: " << duration_par.count() << " секунд\n\n";                    // Время выполнения
 
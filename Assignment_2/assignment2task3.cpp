@@ -6,31 +6,36 @@
 
 #include <iostream>      // Для работы с вводом/выводом (cout, cin, endl)
 #include <vector>        // Подключение контейнера vector
-#include <random>        // Для генерации случайных чисел (random_device, mt19937, uniform_int_distribution)
 #include <chrono>        // Для измерения времени выполнения
+#include <algorithm>     // Для is_sorted
+#include <cstdint>       // Для uint64_t
 #include <omp.h>         // Для OpenMP (параллельные вычисления)
+#include "../Common/data_generator.h"  // Параллельная генерация массивов (счётчиковый генератор)
+#include "../Common/selection_sort.h"  // Параллельная сортировка выбором с постоянной командой потоков
+#include "../Common/arena.h"           // Буфер замеров: вход восстанавливается перед каждой сортировкой
 using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
 
 
-// Функция заполнения массива случайными числами
-void fillArray(vector<int>& arr) {                  // Функция принимает массив по ссылке
-    random_device rd;                  // random_device используется как источник случайности
-    mt19937 gen(rd());                 // mt19937 — генератор случайных чисел Mersenne Twister
-                                       // Инициализируем его значением из rd(), чтобы последовательность была случайной
-    
-    uniform_int_distribution<int> dist(0, 10000);      // uniform_int_distribution задаёт равномерное распределение чисел от 1 до 10000 (можно изменить)
-                                                       // dist(gen) будет возвращать случайное число из этого диапазона
-
+// Функция создания массива случайных чисел
+vector<int> randomArray(int size) {                 // Функция возвращает массив заданного размера
+    vector<int> arr(size);
+    generateArray(arr, Distribution::Uniform, 0, 10000); // Равномерное распределение чисел от 0 до 10000 (Common/data_generator.h):
+                                                         // параллельно, с фиксированным зерном — одинаковые данные в каждом запуске
+    return arr;
+}
 
-    for (int& x : arr) {                              // Проход по всем элементам массива
-        x = dist(gen);                                 // Генерация случайного числа
+// Контрольная сумма массива, не зависящая от порядка элементов: сумма хешей значений (splitMix64 из data_generator.h)
+uint64_t checksum(const int* arr, int n) {
+    uint64_t sum = 0;
+    for (int i = 0; i < n; ++i) {
+        sum += splitMix64(static_cast<uint64_t>(arr[i]));
     }
+    return sum;
 }
 
 
 // Последовательная сортировка выбором
-void selectionSortSequential(vector<int>& arr) {    // Функция последовательной сортировки
-    int n = arr.size();                             // Получение размера массива
+void selectionSortSequential(int* arr, int n) {     // Функция принимает указатель на массив и его размер
 
     for (int i = 0; i < n - 1; ++i) {               // Внешний цикл сортировки
         int minIndex = i;                           // Индекс минимального элемента
@@ -46,51 +51,27 @@ void selectionSortSequential(vector<int>& arr) {    // Функция после
 }
 
 // Параллельная сортировка выбором (OpenMP)
-void selectionSortParallel(vector<int>& arr) {      // Функция параллельной сортировки
-    int n = arr.size();                             // Размер массива
-
-    for (int i = 0; i < n - 1; ++i) {               // Внешний цикл 
-        int minIndex = i;                           // Общий индекс минимума
-
-        #pragma omp parallel                        // Начало параллельной области
-        {
-            int localMinIndex = minIndex;           // Локальный минимум для каждого потока
-
-            #pragma omp for nowait                  // Параллельный цикл поиска минимума
-            for (int j = i + 1; j < n; ++j) {       // Каждый поток проверяет часть массива
-                if (arr[j] < arr[localMinIndex]) {  // Сравнение элементов
-                    localMinIndex = j;              // Обновление локального минимума
-                }
-            }
-
-            #pragma omp critical                    // Критическая секция
-            {
-                if (arr[localMinIndex] < arr[minIndex]) { // Сравнение локального и глобального минимума
-                    minIndex = localMinIndex;             // Обновление глобального минимума
-                }
-            }
-        }
-
-        swap(arr[i], arr[minIndex]);                // Обмен элементов после поиска минимума
-    }
+void selectionSortParallel(int* arr, int n) {       // Функция параллельной сортировки
+    selectionSortTeam(arr, n);                      // Одна команда потоков на всю сортировку (Common/selection_sort.h):
+                                                    // argmin в ячейках потоков без critical, обмен без второго барьера,
+                                                    // маленький остаток — последовательно
 }
 
 
 // Функция тестирования производительности
 void testPerformance(int size) {                    // Функция принимает размер массива
-    vector<int> arr(size);                          // Создание массива заданного размера
-    fillArray(arr);                                 // Заполнение массива случайными числами
-
-    vector<int> arrSeq = arr;                       // Копия массива для последовательной версии
-    vector<int> arrPar = arr;                       // Копия массива для параллельной версии
+    BenchmarkBuffer<int> buffer(randomArray(size)); // Вход и один рабочий массив (Common/arena.h) вместо копии на каждую версию;
+                                                    // временный массив освобождается сразу после копирования во вход
+    uint64_t inputChecksum = checksum(buffer.input(), size); // Набор элементов входа для проверки (вне замера)
 
     auto startSeq = chrono::high_resolution_clock::now(); // Начало замера времени (последовательно)
-    selectionSortSequential(arrSeq);                      // Запуск последовательной сортировки
+    selectionSortSequential(buffer.data(), size);         // Запуск последовательной сортировки
     auto endSeq = chrono::high_resolution_clock::now();   // Конец замера времени
     chrono::duration<double> timeSeq = endSeq - startSeq; // Расчет времени выполнения
 
+    buffer.reset();                                       // Рабочий массив снова равен входу (вне замера)
     auto startPar = chrono::high_resolution_clock::now(); // Начало замера времени (параллельно)
-    selectionSortParallel(arrPar);                        // Запуск параллельной сортировки
+    selectionSortParallel(buffer.data(), size);           // Запуск параллельной сортировки
     auto endPar = chrono::high_resolution_clock::now();   // Конец замера времени
     chrono::duration<double> timePar = endPar - startPar; // Расчет времени выполнения
 
@@ -99,6 +80,9 @@ void testPerformance(int size) {                    // Функция прини
          << timeSeq.count() << " сек" << endl;      // Вывод времени последовательной версии
     cout << "Параллельная сортировка (OpenMP): " 
          << timePar.count() << " сек" << endl;      // Вывод времени параллельной версии
+    cout << "Результат параллельной версии верен: "
+         << (is_sorted(buffer.begin(), buffer.end()) && checksum(buffer.data(), size) == inputChecksum ? "да" : "нет")
+         << endl;                                   // Проверка без копии: массив отсортирован и набор элементов равен входу
 
 }
 
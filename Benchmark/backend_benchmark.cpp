@@ -0,0 +1,196 @@
+// Benchmark: примитивы ComputeBackend (ядра CUDA из блокнотов) на всех доступных бэкендах
+// Те же операции, что в блокнотах Practice4, Practice7, Assignment_2 и Assignment_3: сумма (reduction_shared),
+// префиксная сумма (prefixSumKernel), умножение на число (multiply_shared), сложение векторов (vector_add),
+// сортировка и слияние (mergeKernel). Каждый результат сверяется с последовательным эталоном,
+// поэтому программа проверяет бэкенд и на машине без GPU (бэкенд cpu).
+// Время CUDA-бэкенда включает копирование на устройство и обратно.
+//
+// Компиляция (CPU):  g++ -std=c++17 -O3 -march=native -fopenmp backend_benchmark.cpp -o backend_benchmark
+// Компиляция (CUDA): nvcc -O3 -std=c++17 -DHP_USE_CUDA -c ../Common/cuda_backend.cu -o cuda_backend.o
+//                    g++ -std=c++17 -O3 -march=native -fopenmp -DHP_USE_CUDA backend_benchmark.cpp cuda_backend.o
+//                            -L/usr/local/cuda/lib64 -lcudart -o backend_benchmark
+// Запуск:            ./backend_benchmark [--backend all|auto|cpu|cuda] [--n 10000000] [--reps 10] [--warmup 2]
+//                                        [--only scan] [--csv results.csv] [--json results.json]
+
+#include <iostream>      // Для работы с вводом/выводом (cout, cerr, endl)
+#include <string>        // Для аргументов командной строки
+#include <vector>        // Для массивов
+#include <memory>        // Для unique_ptr
+#include <algorithm>     // Для sort, merge
+#include <cstdlib>       // Для strtoull / atoi
+#include <omp.h>         // Для OpenMP
+#include "../Common/benchmark.h"       // Замер с прогревом, повторами и статистикой
+#include "../Common/data_generator.h"  // Параллельная генерация массивов
+#include "../Common/backend.h"         // Выбор вычислительного бэкенда
+
+using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
+
+// Параметры запуска (--reps, --warmup, --csv, --json — в BenchmarkArgs)
+struct Config : BenchmarkArgs {
+    size_t n = 10000000;                          // Размер массивов
+    string backend = "all";                       // all или имя бэкенда для createBackend
+    string only;                                  // Запускать только группы, имя которых содержит эту строку
+};
+
+// Нужно ли запускать группу с этим именем
+bool selected(const Config& config, const string& group) {
+    return config.only.empty() || group.find(config.only) != string::npos;
+}
+
+// Входные данные и эталонные результаты (считаются один раз последовательно)
+struct Inputs {
+    vector<int> ints;                             // Для суммы и сортировки
+    vector<int> scanInput;                        // Для скана: значения 0..99, чтобы префиксные суммы int не переполнялись
+    vector<int> left, right;                      // Отсортированные половины для слияния
+    vector<float> a, b;                           // Для map
+    long long sum = 0;
+    vector<int> inclusive, exclusive, sorted, merged;
+    vector<float> scaled, added;
+};
+
+const float SCALE_FACTOR = 2.5f;                  // Множитель, как в Assignment3_task1
+
+Inputs prepareInputs(size_t n) {
+    Inputs in;
+    in.ints = generateArray(n, Distribution::Uniform, 0, 99999);
+    in.scanInput = generateArray(n, Distribution::Uniform, 0, 99, substreamSeed(GENERATOR_DEFAULT_SEED, 3));
+    in.left.assign(in.ints.begin(), in.ints.begin() + n / 2);
+    in.right.assign(in.ints.begin() + n / 2, in.ints.end());
+    sort(in.left.begin(), in.left.end());
+    sort(in.right.begin(), in.right.end());
+    in.a = generateArray(n, Distribution::Uniform, -1000.0f, 1000.0f, substreamSeed(GENERATOR_DEFAULT_SEED, 1));
+    in.b = generateArray(n, Distribution::Uniform, -1000.0f, 1000.0f, substreamSeed(GENERATOR_DEFAULT_SEED, 2));
+
+    in.inclusive.resize(n);
+    in.exclusive.resize(n);
+    int running = 0;                              // Префиксные суммы в int, как в prefixSumKernel
+    for (size_t i = 0; i < n; ++i) {
+        in.exclusive[i] = running;
+        running += in.scanInput[i];
+        in.inclusive[i] = running;
+        in.sum += in.ints[i];
+    }
+    in.sorted = in.ints;
+    sort(in.sorted.begin(), in.sorted.end());
+    in.merged.resize(n);
+    merge(in.left.begin(), in.left.end(), in.right.begin(), in.right.end(), in.merged.begin());
+    in.scaled.resize(n);
+    in.added.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        in.scaled[i] = in.a[i] * SCALE_FACTOR;
+        in.added[i] = in.a[i] + in.b[i];
+    }
+    return in;
+}
+
+// Проверка результата бэкенда; при расхождении — сообщение в cerr
+template <typename T>
+bool check(const string& what, const ComputeBackend& backend, const vector<T>& got, const vector<T>& expected) {
+    if (got == expected) return true;
+    cerr << "ОШИБКА: " << what << " на бэкенде " << backend.name() << " не совпадает с эталоном" << endl;
+    return false;
+}
+
+// Все примитивы одного бэкенда; false — хотя бы один результат неверен
+bool benchBackend(const Config& config, ComputeBackend& backend, const Inputs& in, vector<BenchmarkResult>& results) {
+    const BenchmarkOptions& opt = config.options;
+    size_t n = in.ints.size();
+    string suffix = " n=" + to_string(n);
+    bool ok = true;
+
+    if (selected(config, "reduce")) {
+        long long sum = 0;
+        addResult(results, runBenchmark("reduce" + suffix, backend.name(), n, n * sizeof(int), opt,
+                                        [&] { sum = backend.reduceSum(in.ints.data(), n); doNotOptimize(sum); }));
+        if (sum != in.sum) {
+            cerr << "ОШИБКА: reduce на бэкенде " << backend.name() << ": " << sum << " вместо " << in.sum << endl;
+            ok = false;
+        }
+    }
+
+    if (selected(config, "scan")) {
+        vector<int> out(n);
+        addResult(results, runBenchmark("scan inclusive" + suffix, backend.name(), n, 2 * n * sizeof(int), opt,
+                                        [&] { backend.scan(in.scanInput.data(), out.data(), n, true); doNotOptimize(out.data()); }));
+        ok = check("inclusive scan", backend, out, in.inclusive) && ok;
+        addResult(results, runBenchmark("scan exclusive" + suffix, backend.name(), n, 2 * n * sizeof(int), opt,
+                                        [&] { backend.scan(in.scanInput.data(), out.data(), n, false); doNotOptimize(out.data()); }));
+        ok = check("exclusive scan", backend, out, in.exclusive) && ok;
+    }
+
+    if (selected(config, "map")) {
+        vector<float> work;
+        addResult(results, runBenchmark("map scale" + suffix, backend.name(), n, 2 * n * sizeof(float), opt,
+                                        [&] { work = in.a; },
+                                        [&] { backend.mapScale(work.data(), n, SCALE_FACTOR); doNotOptimize(work.data()); }));
+        ok = check("map scale", backend, work, in.scaled) && ok;
+        vector<float> c(n);
+        addResult(results, runBenchmark("map add" + suffix, backend.name(), n, 3 * n * sizeof(float), opt,
+                                        [&] { backend.mapAdd(in.a.data(), in.b.data(), c.data(), n); doNotOptimize(c.data()); }));
+        ok = check("map add", backend, c, in.added) && ok;
+    }
+
+    if (selected(config, "sort")) {
+        vector<int> work;
+        addResult(results, runBenchmark("sort" + suffix, backend.name(), n, n * sizeof(int), opt,
+                                        [&] { work = in.ints; },
+                                        [&] { backend.sort(work.data(), n); doNotOptimize(work.data()); }));
+        ok = check("sort", backend, work, in.sorted) && ok;
+    }
+
+    if (selected(config, "merge")) {
+        vector<int> out(n);
+        addResult(results, runBenchmark("merge" + suffix, backend.name(), n, 2 * n * sizeof(int), opt,
+                                        [&] { backend.merge(in.left.data(), in.left.size(), in.right.data(), in.right.size(), out.data());
+                                              doNotOptimize(out.data()); }));
+        ok = check("merge", backend, out, in.merged) && ok;
+    }
+    return ok;
+}
+
+bool parseArgs(int argc, char** argv, Config& config) {
+    bool parsed = parseBenchmarkArgs(argc, argv, config, [&](const string& arg, const string& value) {
+        if (arg == "--n") config.n = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--backend") config.backend = value;
+        else if (arg == "--threads") omp_set_num_threads(atoi(value.c_str()));
+        else if (arg == "--only") config.only = value;
+        else return FlagStatus::Unknown;
+        return FlagStatus::Ok;
+    });
+    if (!parsed) return false;
+    if (config.n < 2 || config.options.repetitions <= 0 || config.options.warmup < 0) {
+        cerr << "Размер должен быть не меньше 2, число повторов — положительным" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {                   // Основная функция
+    Config config;
+    if (!parseArgs(argc, argv, config)) return 1;
+
+    vector<string> names = config.backend == "all" ? availableBackends() : vector<string>(1, config.backend);
+    cout << "Потоков OpenMP: " << omp_get_max_threads() << ", бэкенды:";
+    for (const string& name : names) cout << " " << name;
+    cout << ", повторов: " << config.options.repetitions << " (прогрев " << config.options.warmup << ")" << endl;
+
+    Inputs in = prepareInputs(config.n);
+    vector<BenchmarkResult> results;
+    bool ok = true;
+    for (const string& name : names) {
+        unique_ptr<ComputeBackend> backend = createBackend(name);
+        if (!backend) {
+            cerr << "Бэкенд недоступен (не собран или нет устройства): " << name << endl;
+            return 1;
+        }
+        ok = benchBackend(config, *backend, in, results) && ok;
+    }
+
+    // Группы идут подряд по бэкендам — сортируем по группе, чтобы бэкенды одной операции стояли рядом
+    stable_sort(results.begin(), results.end(),
+                [](const BenchmarkResult& x, const BenchmarkResult& y) { return x.group < y.group; });
+    printBenchmarkTable(results, cout);
+
+    ok = writeResultFiles(results, config.csvPath, config.jsonPath) && ok;
+    return ok ? 0 : 1;                              // Ненулевой код, если какой-то бэкенд дал неверный результат
+}
@@ -0,0 +1,581 @@
+// Benchmark: единый замер ядер библиотеки Common
+// Каждое ядро (редукции, статистика, скан, сортировки, в том числе на пуле потоков) запускается несколько раз после прогрева,
+// в отчёте — минимум, медиана, 95-й перцентиль (ms), ГБ/с, элементы/с и ускорение относительно
+// последовательного эталона. Результаты печатаются таблицей и сохраняются в CSV / JSON. Результат каждой редукции
+// (в том числе на пуле и dispatch), скана (в том числе с операцией min) и сортировки сверяется с последовательным
+// эталоном; при ошибке код возврата 1.
+// В группы sum, scan и sort добавляется строка того же примитива через ComputeBackend (Common/backend.h): бэкенд
+// выбирается флагом --backend (по умолчанию HP_BACKEND или auto — CUDA, если программа собрана с HP_USE_CUDA и есть
+// устройство, иначе CPU; none — без этих строк).
+// Режим --scaling перебирает число потоков и размеры: strong / weak scaling с аппроксимацией законами
+// Амдала и Густафсона и точка окупаемости (размер, с которого параллельная версия быстрее последовательной).
+// Режим --numa сравнивает редукции над массивом, заполненным главным потоком, и над NumaBuffer (параллельный first touch)
+// при разных политиках закрепления потоков; печатает, на каких узлах лежат страницы и работают потоки.
+//
+// Компиляция: g++ -std=c++17 -O3 -march=native -fopenmp benchmark.cpp -o benchmark
+//             (с CUDA — как backend_benchmark.cpp: -DHP_USE_CUDA и cuda_backend.o)
+// Запуск:     ./benchmark [--n 10000000] [--small-n 10000] [--reps 10] [--warmup 2] [--threads 8]
+//                         [--dist uniform|sorted|reverse|nearly-sorted|few-unique] [--only sort]
+//                         [--backend auto|cpu|cuda|none] [--csv results.csv] [--json results.json]
+//             ./benchmark --scaling strong|weak|crossover|all [--n 10000000] [--only sum]
+//             ./benchmark --numa none|compact|scatter|all [--n 100000000]
+
+#include <iostream>      // Для работы с вводом/выводом (cout, cerr, endl)
+#include <string>        // Для аргументов командной строки
+#include <vector>        // Для массивов
+#include <algorithm>     // Для sort, swap
+#include <cstdlib>       // Для strtoull / atoi
+#include <functional>    // Для function (ядра режима масштабируемости)
+#include <memory>        // Для unique_ptr (бэкенд)
+#include <limits>        // Для numeric_limits (нейтральный элемент min в скане)
+#include <cmath>         // Для fabs (сверка дисперсии)
+#include <omp.h>         // Для OpenMP
+#include "../Common/benchmark.h"       // Замер с прогревом, повторами и статистикой
+#include "../Common/scaling.h"         // Strong / weak scaling, законы Амдала и Густафсона
+#include "../Common/data_generator.h"  // Параллельная генерация массивов
+#include "../Common/reduction.h"       // Параллельные редукции
+#include "../Common/statistics.h"      // Статистика за один проход
+#include "../Common/parallel_sort.h"   // Сортировки слиянием и выборкой
+#include "../Common/radix_sort.h"      // Поразрядная сортировка
+#include "../Common/selection_sort.h"  // Сортировка выбором с постоянной командой потоков
+#include "../Common/odd_even_sort.h"   // Блочная чётно-нечётная сортировка
+#include "../Common/dispatch.h"        // Адаптивный выбор режима исполнения
+#include "../Common/scan.h"            // Параллельный префиксный скан
+#include "../Common/pool_algorithms.h" // Редукции и сортировки на пуле потоков с перехватом работы
+#include "../Common/merge_path.h"      // Сортировка слиянием merge path и k-путевое слияние
+#include "../Common/heap_sort.h"       // Параллельная куча и пирамидальная сортировка
+#include "../Common/hierarchical_reduction.h" // Иерархическая редукция (поток -> узел NUMA -> итог)
+#include "../Common/numa.h"            // Параллельный first touch и закрепление потоков
+#include "../Common/backend.h"         // Вычислительные бэкенды (строки backend в группах sum, scan, sort)
+
+using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
+
+const size_t KMERGE_RUNS = 16;                    // Серий в группе kmerge
+
+// Параметры запуска (--reps, --warmup, --csv, --json — в BenchmarkArgs)
+struct Config : BenchmarkArgs {
+    size_t n = 10000000;                          // Размер массива для редукций и O(n log n) сортировок
+    size_t smallN = 10000;                        // Размер массива для O(n^2) сортировки выбором
+    Distribution dist = Distribution::Uniform;    // Распределение входных данных
+    string only;                                  // Запускать только группы, имя которых содержит эту строку
+    string scaling;                               // Режим масштабируемости (пусто — обычный замер)
+    string numa;                                  // Режим NUMA: политика закрепления или all (пусто — обычный замер)
+    string backend = defaultBackendName();        // Бэкенд для строк backend (auto, cpu, cuda) или none
+};
+
+// Нужно ли запускать группу с этим именем
+bool selected(const Config& config, const string& group) {
+    return config.only.empty() || group.find(config.only) != string::npos;
+}
+
+// ПОСЛЕДОВАТЕЛЬНЫЕ ЭТАЛОНЫ (обычные циклы, как в программах Assignment и Practice)
+long long sumSequential(const vector<int>& a) {
+    long long sum = 0;
+    for (int x : a) sum += x;
+    return sum;
+}
+
+pair<int, int> minMaxSequential(const vector<int>& a) {
+    int mn = a[0], mx = a[0];
+    for (int x : a) {
+        if (x < mn) mn = x;
+        if (x > mx) mx = x;
+    }
+    return {mn, mx};
+}
+
+double varianceSequential(const vector<int>& a) {   // Два прохода: среднее, затем сумма квадратов отклонений
+    double mean = 0;
+    for (int x : a) mean += x;
+    mean /= a.size();
+    double m2 = 0;
+    for (int x : a) m2 += (x - mean) * (x - mean);
+    return m2 / a.size();
+}
+
+size_t argMinSequential(const vector<int>& a) {
+    size_t best = 0;
+    for (size_t i = 1; i < a.size(); ++i) {
+        if (a[i] < a[best]) best = i;
+    }
+    return best;
+}
+
+void scanSequential(const vector<int>& a, vector<int>& out) {   // Как эталон на CPU в Practice7 (runBlellochTest)
+    int acc = 0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        acc += a[i];
+        out[i] = acc;
+    }
+}
+
+void selectionSortSequential(vector<int>& a) {
+    for (size_t i = 0; i + 1 < a.size(); ++i) {
+        size_t minIndex = i;
+        for (size_t j = i + 1; j < a.size(); ++j) {
+            if (a[j] < a[minIndex]) minIndex = j;
+        }
+        swap(a[i], a[minIndex]);
+    }
+}
+
+// РЕДУКЦИИ: входной массив не меняется, подготовка не нужна; результат каждой (последнего замеренного запуска)
+// сверяется с последовательным эталоном; false — есть неверные
+bool benchReductions(const Config& config, const vector<int>& data, ComputeBackend* backend, vector<BenchmarkResult>& results) {
+    size_t n = data.size();
+    size_t bytes = n * sizeof(int);
+    const BenchmarkOptions& opt = config.options;
+    string suffix = " n=" + to_string(n);
+    bool ok = true;
+    auto check = [&](const string& group, const string& name, bool correct) {
+        if (!correct) {
+            cerr << "ОШИБКА: " << group << " " << name << ": результат не совпадает с последовательным" << endl;
+            ok = false;
+        }
+    };
+
+    if (selected(config, "sum")) {
+        string g = "sum" + suffix;
+        long long expected = 0, sum = 0;
+        auto row = [&](const string& name, auto sumFn) {
+            addResult(results, runBenchmark(g, name, n, bytes, opt, [&] { sum = sumFn(data); doNotOptimize(sum); }));
+            check(g, name, sum == expected);
+        };
+        expected = sumSequential(data);
+        row("sequential", [](const vector<int>& a) { return sumSequential(a); });
+        row("parallelSum", [](const vector<int>& a) { return static_cast<long long>(parallelSum(a)); });
+        row("poolSum", [](const vector<int>& a) { return static_cast<long long>(poolSum(a)); });
+        row(string("dispatchSum (") + executionModeName(reduceMode(n)) + ")",
+            [](const vector<int>& a) { return static_cast<long long>(dispatchSum(a)); });
+        if (backend) row(string("backend ") + backend->name(), [&](const vector<int>& a) { return backend->reduceSum(a.data(), a.size()); });
+    }
+    if (selected(config, "minmax")) {
+        string g = "minmax" + suffix;
+        pair<int, int> expected = minMaxSequential(data), result;
+        addResult(results, runBenchmark(g, "sequential", n, bytes, opt, [&] { result = minMaxSequential(data); doNotOptimize(result); }));
+        addResult(results, runBenchmark(g, "parallelMinMax", n, bytes, opt, [&] { result = parallelMinMax(data); doNotOptimize(result); }));
+        check(g, "parallelMinMax", result == expected);
+        addResult(results, runBenchmark(g, "poolMinMax", n, bytes, opt, [&] { result = poolMinMax(data); doNotOptimize(result); }));
+        check(g, "poolMinMax", result == expected);
+    }
+    if (selected(config, "argmin")) {
+        string g = "argmin" + suffix;
+        size_t expected = argMinSequential(data), result = 0;
+        addResult(results, runBenchmark(g, "sequential", n, bytes, opt, [&] { result = argMinSequential(data); doNotOptimize(result); }));
+        addResult(results, runBenchmark(g, "parallelArgMin", n, bytes, opt, [&] { result = parallelArgMin(data); doNotOptimize(result); }));
+        check(g, "parallelArgMin", result == expected);                 // Индекс первого минимума, как в эталоне
+        addResult(results, runBenchmark(g, "poolArgMin", n, bytes, opt, [&] { result = poolArgMin(data); doNotOptimize(result); }));
+        check(g, "poolArgMin", result == expected);
+    }
+    if (selected(config, "statistics")) {
+        string g = "statistics" + suffix;
+        double expected = varianceSequential(data), variance = 0;
+        pair<int, int> range = minMaxSequential(data);
+        Statistics<int> stats;
+        addResult(results, runBenchmark(g, "sequential (2 passes)", n, bytes, opt,
+                                        [&] { variance = varianceSequential(data); doNotOptimize(variance); }));
+        addResult(results, runBenchmark(g, "parallelStatistics", n, bytes, opt,
+                                        [&] { stats = parallelStatistics(data); doNotOptimize(stats.m2); }));
+        // Дисперсия одним проходом (формула Чана) и двумя проходами отличается только округлением
+        check(g, "parallelStatistics", stats.count == n && stats.sum == sumSequential(data) && stats.minValue == range.first
+                                       && stats.maxValue == range.second && fabs(stats.variance() - expected) <= 1e-9 * expected);
+    }
+    return ok;
+}
+
+// СКАН: читает n элементов и пишет n элементов; результат сверяется с последовательным циклом, false — есть неверные
+bool benchScans(const Config& config, const vector<int>& data, ComputeBackend* backend, vector<BenchmarkResult>& results) {
+    if (!selected(config, "scan")) return true;
+    size_t n = data.size();
+    size_t bytes = 2 * n * sizeof(int);                             // Чтение + запись
+    const BenchmarkOptions& opt = config.options;
+    vector<int> out(n), inclusive(n), exclusive(n), runningMin(n);
+    scanSequential(data, inclusive);
+    for (size_t i = 0; i < n; ++i) {
+        exclusive[i] = i == 0 ? 0 : inclusive[i - 1];
+        runningMin[i] = i == 0 ? data[0] : min(runningMin[i - 1], data[i]);
+    }
+    bool ok = true;
+    auto check = [&](const string& name, const vector<int>& expected) {
+        if (out != expected) {
+            cerr << "ОШИБКА: scan " << name << ": результат не совпадает с последовательным" << endl;
+            ok = false;
+        }
+    };
+    auto minOp = [](int a, int b) { return a < b ? a : b; };        // Не сумма: нейтральный элемент не T() = 0, а max()
+
+    string g = "scan n=" + to_string(n);
+    addResult(results, runBenchmark(g, "sequential", n, bytes, opt, [&] { scanSequential(data, out); doNotOptimize(out.data()); }));
+    addResult(results, runBenchmark(g, "inclusiveScan", n, bytes, opt, [&] { inclusiveScan(data, out); doNotOptimize(out.data()); }));
+    check("inclusiveScan", inclusive);
+    addResult(results, runBenchmark(g, "exclusiveScan", n, bytes, opt, [&] { exclusiveScan(data, out); doNotOptimize(out.data()); }));
+    check("exclusiveScan", exclusive);
+    addResult(results, runBenchmark(g, "inclusiveScan min", n, bytes, opt,
+                                    [&] { inclusiveScan(data, out, minOp, numeric_limits<int>::max()); doNotOptimize(out.data()); }));
+    check("inclusiveScan min", runningMin);
+    if (backend) {
+        string name = string("backend ") + backend->name();
+        addResult(results, runBenchmark(g, name, n, bytes, opt, [&] { backend->scan(data.data(), out.data(), n, true); doNotOptimize(out.data()); }));
+        check(name, inclusive);
+    }
+    return ok;
+}
+
+// Замер сортировки: перед каждым запуском рабочий массив восстанавливается из data (не замеряется)
+template <typename Sort>
+BenchmarkResult benchSort(const string& group, const string& name, const BenchmarkOptions& opt,
+                          const vector<int>& data, vector<int>& work, Sort sort) {
+    return runBenchmark(group, name, data.size(), data.size() * sizeof(int), opt,
+                        [&] { work = data; },
+                        [&] { sort(work); doNotOptimize(work.data()); });
+}
+
+// СОРТИРОВКИ: результат каждой (последнего замеренного запуска) сверяется с std::sort; false — есть неверные
+bool benchSorts(const Config& config, const vector<int>& data, const vector<int>& small, ComputeBackend* backend,
+                vector<BenchmarkResult>& results) {
+    const BenchmarkOptions& opt = config.options;
+    vector<int> work;                                               // Рабочая копия, сортируется на месте
+    bool ok = true;
+    auto check = [&](const string& group, const string& name, const vector<int>& result, const vector<int>& expected) {
+        if (result != expected) {
+            cerr << "ОШИБКА: " << group << " " << name << ": результат не совпадает с std::sort" << endl;
+            ok = false;
+        }
+    };
+
+    vector<int> expected;                                           // Эталон std::sort для групп sort и kmerge
+    if (selected(config, "sort") || selected(config, "kmerge")) {
+        expected = data;
+        sort(expected.begin(), expected.end());
+    }
+
+    if (selected(config, "sort")) {
+        string g = string("sort ") + distributionName(config.dist) + " n=" + to_string(data.size());
+        auto row = [&](const string& name, auto sortFn) {
+            addResult(results, benchSort(g, name, opt, data, work, sortFn));
+            check(g, name, work, expected);
+        };
+        row("std::sort", [](vector<int>& a) { sort(a.begin(), a.end()); });
+        row("parallelMergeSort", [](vector<int>& a) { parallelMergeSort(a); });
+        row("mergePathSort", [](vector<int>& a) { mergePathSort(a); });
+        row("parallelSampleSort", [](vector<int>& a) { parallelSampleSort(a); });
+        row("radixSortParallel", [](vector<int>& a) { radixSortParallel(a); });
+        row("poolMergeSort", [](vector<int>& a) { poolMergeSort(a); });
+        row("poolQuickSort", [](vector<int>& a) { poolQuickSort(a); });
+        row("parallelHeapSort", [](vector<int>& a) { parallelHeapSort(a); });
+        row("oddEvenSortParallel", [](vector<int>& a) { oddEvenSortParallel(a); });
+        row(string("dispatchSort (") + executionModeName(sortMode(data.size())) + ")", [](vector<int>& a) { dispatchSort(a); });
+        if (backend) row(string("backend ") + backend->name(), [&](vector<int>& a) { backend->sort(a.data(), a.size()); });
+    }
+    if (selected(config, "kmerge")) {                               // Слияние KMERGE_RUNS готовых серий
+        vector<int> runsData = data;
+        vector<size_t> offsets;
+        for (size_t r = 0; r <= KMERGE_RUNS; ++r) offsets.push_back(runsData.size() * r / KMERGE_RUNS);
+        for (size_t r = 0; r < KMERGE_RUNS; ++r) sort(runsData.begin() + offsets[r], runsData.begin() + offsets[r + 1]);
+        vector<SortedRun<int>> runs = runsFromOffsets(runsData.data(), offsets);
+        vector<int> out(runsData.size());
+
+        string g = string("kmerge k=") + to_string(KMERGE_RUNS) + " n=" + to_string(data.size());
+        size_t n = data.size(), bytes = n * sizeof(int);
+        addResult(results, runBenchmark(g, "loserTreeMerge", n, bytes, opt, [&] { loserTreeMerge(runs, out.data()); doNotOptimize(out.data()); }));
+        check(g, "loserTreeMerge", out, expected);
+        addResult(results, runBenchmark(g, "parallelKWayMerge", n, bytes, opt, [&] { parallelKWayMerge(runs, out.data()); doNotOptimize(out.data()); }));
+        check(g, "parallelKWayMerge", out, expected);
+    }
+    if (selected(config, "selection")) {
+        vector<int> expected = small;
+        sort(expected.begin(), expected.end());
+        string g = string("selection ") + distributionName(config.dist) + " n=" + to_string(small.size());
+        addResult(results, benchSort(g, "sequential", opt, small, work, [](vector<int>& a) { selectionSortSequential(a); }));
+        check(g, "sequential", work, expected);
+        addResult(results, benchSort(g, "selectionSortTeam", opt, small, work, [](vector<int>& a) { selectionSortTeam(a); }));
+        check(g, "selectionSortTeam", work, expected);
+    }
+    return ok;
+}
+
+// РЕЖИМ МАСШТАБИРУЕМОСТИ
+
+// Ядро: последовательный эталон и параллельная версия над рабочим массивом
+struct ScalingKernel {
+    string name;
+    bool mutates;                                   // Меняет массив (сортировка) — перед каждым запуском копия входа
+    function<void(vector<int>&)> sequential;
+    function<void(vector<int>&)> parallel;
+};
+
+vector<int>& scanOutput() {                         // Буфер результата скана для режима масштабируемости
+    static vector<int> out;
+    return out;
+}
+
+vector<ScalingKernel> scalingKernels() {
+    return {
+        {"sum", false, [](vector<int>& a) { doNotOptimize(sumSequential(a)); },
+                       [](vector<int>& a) { doNotOptimize(parallelSum(a)); }},
+        // Голый omp parallel for без порога REDUCTION_SEQUENTIAL_CUTOFF — по нему видно, где ставить порог
+        {"sum-omp", false, [](vector<int>& a) { doNotOptimize(sumSequential(a)); },
+                           [](vector<int>& a) {
+                               long long sum = 0;
+                               #pragma omp parallel for reduction(+ : sum)
+                               for (size_t i = 0; i < a.size(); ++i) sum += a[i];
+                               doNotOptimize(sum);
+                           }},
+        {"minmax", false, [](vector<int>& a) { doNotOptimize(minMaxSequential(a)); },
+                          [](vector<int>& a) { doNotOptimize(parallelMinMax(a)); }},
+        {"minmax-omp", false, [](vector<int>& a) { doNotOptimize(minMaxSequential(a)); },
+                              [](vector<int>& a) {
+                                  int mn = a[0], mx = a[0];
+                                  #pragma omp parallel for reduction(min : mn) reduction(max : mx)
+                                  for (size_t i = 0; i < a.size(); ++i) {
+                                      if (a[i] < mn) mn = a[i];
+                                      if (a[i] > mx) mx = a[i];
+                                  }
+                                  doNotOptimize(mn);
+                                  doNotOptimize(mx);
+                              }},
+        {"statistics", false, [](vector<int>& a) { doNotOptimize(varianceSequential(a)); },
+                              [](vector<int>& a) { doNotOptimize(parallelStatistics(a).variance()); }},
+        // Буфер результата общий и переживает вызовы: выделение памяти не попадает в замер (прогрев его создаёт)
+        {"scan", false, [](vector<int>& a) { scanOutput().resize(a.size()); scanSequential(a, scanOutput()); },
+                        [](vector<int>& a) { inclusiveScan(a, scanOutput()); doNotOptimize(scanOutput().data()); }},
+        {"mergesort", true, [](vector<int>& a) { sort(a.begin(), a.end()); },
+                            [](vector<int>& a) { parallelMergeSort(a); }},
+        {"mergepath", true, [](vector<int>& a) { sort(a.begin(), a.end()); },
+                            [](vector<int>& a) { mergePathSort(a); }},
+        {"samplesort", true, [](vector<int>& a) { sort(a.begin(), a.end()); },
+                             [](vector<int>& a) { parallelSampleSort(a); }},
+        {"radixsort", true, [](vector<int>& a) { sort(a.begin(), a.end()); },
+                            [](vector<int>& a) { radixSortParallel(a); }},
+    };
+}
+
+// Медиана времени f над копией data
+double medianTime(const BenchmarkOptions& opt, const vector<int>& data, bool mutates,
+                  const function<void(vector<int>&)>& f) {
+    vector<int> work = data;
+    return runBenchmark("", "", data.size(), 0, opt,
+                        [&] { if (mutates) work = data; },
+                        [&] { f(work); }).medianMs;
+}
+
+void printFit(const string& mode, const vector<ScalingPoint>& points, size_t maxN) {
+    if (mode == "strong") {
+        double f = fitAmdahl(points);
+        if (f < 0) cout << "Закон Амдала: нужно больше одного потока\n";
+        else cout << "Закон Амдала: параллельная доля f = " << f << ", предел ускорения 1/(1-f) = "
+                  << (f < 1 ? 1.0 / (1.0 - f) : 0) << (f < 1 ? "x" : " (не ограничен)") << "\n";
+    } else if (mode == "weak") {
+        double sFrac = fitGustafson(points);
+        if (sFrac < 0) cout << "Закон Густафсона: нужно больше одного потока\n";
+        else cout << "Закон Густафсона: последовательная доля s = " << sFrac << "\n";
+    } else {
+        size_t crossover = findCrossover(points);
+        if (crossover == 0) cout << "Точка окупаемости: параллельная версия не быстрее до n = " << maxN << "\n";
+        else cout << "Точка окупаемости: параллельная версия быстрее при n >= " << crossover << "\n";
+    }
+}
+
+// Перебор потоков и размеров для выбранных ядер
+void runScaling(const Config& config, vector<ScalingPoint>& all) {
+    int maxThreads = omp_get_max_threads();
+    vector<string> modes = config.scaling == "all" ? vector<string>{"strong", "weak", "crossover"}
+                                                   : vector<string>{config.scaling};
+    for (const ScalingKernel& kernel : scalingKernels()) {
+        if (!selected(config, kernel.name)) continue;
+        for (const string& mode : modes) {
+            vector<ScalingPoint> points;
+            if (mode == "strong") {                     // Размер фиксирован, потоков больше
+                vector<int> data = generateArray(config.n, config.dist, 0, 99999);
+                double t1 = 0;
+                for (int p : threadSweep(maxThreads)) {
+                    omp_set_num_threads(p);
+                    ScalingPoint pt{mode, kernel.name, p, config.n};
+                    pt.parallelMs = medianTime(config.options, data, kernel.mutates, kernel.parallel);
+                    if (p == 1) t1 = pt.parallelMs;
+                    pt.speedup = pt.parallelMs > 0 ? t1 / pt.parallelMs : 0;
+                    pt.efficiency = pt.speedup / p;
+                    points.push_back(pt);
+                }
+            } else if (mode == "weak") {                // Работа на поток фиксирована
+                size_t perThread = config.n / maxThreads > 0 ? config.n / maxThreads : 1;
+                double t1 = 0;
+                for (int p : threadSweep(maxThreads)) {
+                    omp_set_num_threads(p);
+                    vector<int> data = generateArray(perThread * p, config.dist, 0, 99999);
+                    ScalingPoint pt{mode, kernel.name, p, data.size()};
+                    pt.parallelMs = medianTime(config.options, data, kernel.mutates, kernel.parallel);
+                    if (p == 1) t1 = pt.parallelMs;
+                    pt.efficiency = pt.parallelMs > 0 ? t1 / pt.parallelMs : 0;
+                    pt.speedup = pt.efficiency * p;     // Масштабированное ускорение
+                    points.push_back(pt);
+                }
+            } else {                                    // Все потоки, размер растёт
+                omp_set_num_threads(maxThreads);
+                for (size_t n : sizeSweep(100, config.n)) {
+                    vector<int> data = generateArray(n, config.dist, 0, 99999);
+                    ScalingPoint pt{mode, kernel.name, maxThreads, n};
+                    pt.sequentialMs = medianTime(config.options, data, kernel.mutates, kernel.sequential);
+                    pt.parallelMs = medianTime(config.options, data, kernel.mutates, kernel.parallel);
+                    pt.speedup = pt.parallelMs > 0 ? pt.sequentialMs / pt.parallelMs : 0;
+                    pt.efficiency = pt.speedup / maxThreads;
+                    points.push_back(pt);
+                }
+            }
+            omp_set_num_threads(maxThreads);
+
+            cout << "\n" << kernel.name << " — " << mode << " scaling\n";
+            printScalingTable(points, cout);
+            printFit(mode, points, config.n);
+            all.insert(all.end(), points.begin(), points.end());
+        }
+    }
+}
+
+// Узлы страниц массива: "узел 0: 9766, узел 1: 0" (или "неизвестно")
+string histogramText(const vector<size_t>& histogram) {
+    if (histogram.empty()) return "неизвестно";
+    string text;
+    for (size_t node = 0; node < histogram.size(); ++node) {
+        text += (node ? ", узел " : "узел ") + to_string(node) + ": " + to_string(histogram[node]);
+    }
+    return text;
+}
+
+// РЕЖИМ NUMA: массив, заполненный главным потоком (как в программах курса), против NumaBuffer для каждой политики
+bool runNuma(const Config& config, vector<BenchmarkResult>& results) {
+    vector<PinPolicy> policies;
+    if (config.numa == "all") policies = {PinPolicy::None, PinPolicy::Compact, PinPolicy::Scatter};
+    else {
+        PinPolicy policy = PinPolicy::None;
+        parsePinPolicy(config.numa, policy);
+        policies = {policy};
+    }
+    size_t n = config.n;
+    size_t bytes = n * sizeof(int);
+    const BenchmarkOptions& opt = config.options;
+    cout << "Узлов NUMA: " << numaNodeCount() << ", доступных ядер: " << allowedCpus().size() << endl;
+    bool ok = true;
+
+    for (PinPolicy policy : policies) {
+        string p = pinPolicyName(policy);
+        if (!pinOpenMPThreads(policy)) cout << p << ": не удалось закрепить потоки" << endl;
+        // Закрепление — до заполнения: страницы ложатся на узлы уже закреплённых потоков
+        vector<int> serial(n);                      // Нули пишет главный поток — все страницы на его узле
+        generateArray(serial, config.dist, 0, 99999);
+        NumaBuffer<int> local(n);                   // Параллельный first touch тем же разбиением, что у редукций
+        generateArray(local.data(), n, config.dist, 0, 99999);
+
+        vector<int> threadNodes = openMPThreadNodes();
+        cout << "\n" << p << ": узлы потоков:";
+        for (int node : threadNodes) cout << " " << node;
+        cout << "\n  страницы vector (главный поток): " << histogramText(pageNodeHistogram(serial.data(), bytes))
+             << "\n  страницы NumaBuffer:             " << histogramText(local.nodeHistogram()) << endl;
+
+        long long expected = parallelSum(serial);
+        auto row = [&](const string& group, const string& name, long long (*sum)(const int*, size_t), const int* data) {
+            long long value = 0;
+            addResult(results, runBenchmark(group, name, n, bytes, opt, [&] { value = sum(data, n); doNotOptimize(value); }));
+            if (value != expected) {
+                cerr << "ОШИБКА: " << group << " " << name << ": сумма " << value << " вместо " << expected << endl;
+                ok = false;
+            }
+        };
+        auto flat = [](const int* data, size_t count) -> long long { return parallelSum(data, count); };
+        auto tree = [](const int* data, size_t count) -> long long { return hierarchicalSum(data, count); };
+        string g = "numa sum n=" + to_string(n);
+        row(g, "vector / " + p, flat, serial.data());
+        row(g, "first touch / " + p, flat, local.data());
+        g = "numa tree n=" + to_string(n);
+        row(g, "vector / " + p, tree, serial.data());
+        row(g, "first touch / " + p, tree, local.data());
+    }
+    pinOpenMPThreads(PinPolicy::None);
+    cout << endl;
+    return ok;
+}
+
+// Разбор аргументов командной строки; false — ошибка
+bool parseArgs(int argc, char** argv, Config& config) {
+    bool parsed = parseBenchmarkArgs(argc, argv, config, [&](const string& arg, const string& value) {
+        if (arg == "--n") config.n = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--small-n") config.smallN = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--threads") omp_set_num_threads(atoi(value.c_str()));
+        else if (arg == "--only") config.only = value;
+        else if (arg == "--backend") config.backend = value;
+        else if (arg == "--scaling") {
+            if (value != "strong" && value != "weak" && value != "crossover" && value != "all") {
+                cerr << "Режим --scaling: strong, weak, crossover или all" << endl;
+                return FlagStatus::Invalid;
+            }
+            config.scaling = value;
+        }
+        else if (arg == "--numa") {
+            PinPolicy policy;
+            if (value != "all" && !parsePinPolicy(value, policy)) {
+                cerr << "Режим --numa: none, compact, scatter или all" << endl;
+                return FlagStatus::Invalid;
+            }
+            config.numa = value;
+        }
+        else if (arg == "--dist") {
+            if (!parseDistribution(value, config.dist)) {
+                cerr << "Неизвестное распределение: " << value << endl;
+                return FlagStatus::Invalid;
+            }
+        }
+        else return FlagStatus::Unknown;
+        return FlagStatus::Ok;
+    });
+    if (!parsed) return false;
+    if (config.n == 0 || config.smallN == 0 || config.options.repetitions <= 0 || config.options.warmup < 0) {
+        cerr << "Размеры и число повторов должны быть положительными" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {                   // Основная функция
+    Config config;
+    if (!parseArgs(argc, argv, config)) return 1;
+
+    cout << "Потоков OpenMP: " << omp_get_max_threads() << ", SIMD: " << simdLevelName(detectSimdLevel())
+         << ", повторов: " << config.options.repetitions << " (прогрев " << config.options.warmup << ")" << endl;
+
+    if (!config.scaling.empty()) {                 // Режим масштабируемости
+        vector<ScalingPoint> points;
+        runScaling(config, points);
+        return writeResultFiles(points, config.csvPath, config.jsonPath) ? 0 : 1;
+    }
+
+    if (!config.numa.empty()) {                    // Режим NUMA: таблица, CSV и JSON как у обычного замера
+        vector<BenchmarkResult> results;
+        bool ok = runNuma(config, results);
+        printBenchmarkTable(results, cout);
+        ok = writeResultFiles(results, config.csvPath, config.jsonPath) && ok;
+        return ok ? 0 : 1;
+    }
+
+    unique_ptr<ComputeBackend> backend;            // Строки backend в группах sum, scan, sort (none — без них)
+    if (config.backend != "none") {
+        backend = createBackend(config.backend);
+        if (!backend) {
+            cerr << "Бэкенд недоступен (не собран или нет устройства): " << config.backend << endl;
+            return 1;
+        }
+    }
+
+    vector<int> data = generateArray(config.n, config.dist, 0, 99999);       // Те же данные в каждом запуске
+    vector<int> small = generateArray(config.smallN, config.dist, 0, 99999);
+
+    vector<BenchmarkResult> results;
+    bool ok = benchReductions(config, data, backend.get(), results);
+    ok = benchScans(config, data, backend.get(), results) && ok;
+    ok = benchSorts(config, data, small, backend.get(), results) && ok;
+
+    printBenchmarkTable(results, cout);
+    if (!ok) cout << "Есть неверные результаты редукций, сканов или сортировок" << endl;
+
+    ok = writeResultFiles(results, config.csvPath, config.jsonPath) && ok;
+    return ok ? 0 : 1;                              // Ненулевой код, если какая-то редукция, скан или сортировка неверны
+}
@@ -0,0 +1,141 @@
+// Benchmark: цена общей горячей точки в редукции — atomic и critical против иерархической редукции
+// Повторяет на CPU схемы из программ курса:
+//   - atomic на каждый элемент — sumKernel (Assignment_4) и reduction_global (Practice4): atomicAdd в один d_result;
+//   - critical на каждый элемент и critical на поток — первые версии assignment1_task2;
+//   - omp reduction — стандартная редукция OpenMP;
+//   - tree — hierarchicalSum (Common/hierarchical_reduction.h): поток -> узел NUMA -> итог.
+// Каждая схема замеряется на 1, 2, 4, ..., max потоках; все суммы 64-битные и сверяются с эталоном.
+// Дополнительно печатается, что дала бы 32-битная сумма int, как в блокнотах (переполнение для больших N).
+//
+// Компиляция: g++ -std=c++17 -O3 -march=native -fopenmp contention_benchmark.cpp -o contention_benchmark
+// Запуск:     ./contention_benchmark [--n 4000000] [--max-threads 8] [--reps 5] [--warmup 1]
+//                                    [--csv results.csv] [--json results.json]
+
+#include <iostream>      // Для работы с вводом/выводом (cout, cerr, endl)
+#include <string>        // Для аргументов командной строки
+#include <vector>        // Для массивов
+#include <cstdint>       // Для int32_t / uint32_t
+#include <cstdlib>       // Для strtoull / atoi
+#include <omp.h>         // Для OpenMP
+#include "../Common/benchmark.h"               // Замер с прогревом, повторами и статистикой
+#include "../Common/scaling.h"                 // Для threadSweep
+#include "../Common/data_generator.h"          // Параллельная генерация массивов
+#include "../Common/hierarchical_reduction.h"  // Иерархическая редукция
+
+using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
+
+// Параметры запуска (--reps, --warmup, --csv, --json — в BenchmarkArgs)
+struct Config : BenchmarkArgs {
+    size_t n = 4000000;                           // Размер массива (critical на элемент очень медленный)
+    int maxThreads = omp_get_max_threads();       // Наибольшее число потоков
+};
+
+// СХЕМЫ РЕДУКЦИИ (все возвращают 64-битную сумму)
+long long sumSequential(const vector<int>& a) {
+    long long sum = 0;
+    for (int x : a) sum += x;
+    return sum;
+}
+
+long long sumAtomicPerElement(const vector<int>& a) {  // Как atomicAdd(d_result, d_array[idx])
+    long long sum = 0;
+    #pragma omp parallel for
+    for (size_t i = 0; i < a.size(); ++i) {
+        #pragma omp atomic
+        sum += a[i];
+    }
+    return sum;
+}
+
+long long sumCriticalPerElement(const vector<int>& a) {
+    long long sum = 0;
+    #pragma omp parallel for
+    for (size_t i = 0; i < a.size(); ++i) {
+        #pragma omp critical
+        sum += a[i];
+    }
+    return sum;
+}
+
+long long sumCriticalPerThread(const vector<int>& a) {  // Локальная сумма, critical один раз на поток
+    long long sum = 0;
+    #pragma omp parallel
+    {
+        long long local = 0;
+        #pragma omp for nowait
+        for (size_t i = 0; i < a.size(); ++i) local += a[i];
+        #pragma omp critical
+        sum += local;
+    }
+    return sum;
+}
+
+long long sumOmpReduction(const vector<int>& a) {
+    long long sum = 0;
+    #pragma omp parallel for reduction(+:sum)
+    for (size_t i = 0; i < a.size(); ++i) sum += a[i];
+    return sum;
+}
+
+bool parseArgs(int argc, char** argv, Config& config) {
+    bool parsed = parseBenchmarkArgs(argc, argv, config, [&](const string& arg, const string& value) {
+        if (arg == "--n") config.n = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--max-threads") config.maxThreads = atoi(value.c_str());
+        else return FlagStatus::Unknown;
+        return FlagStatus::Ok;
+    });
+    if (!parsed) return false;
+    if (config.n == 0 || config.maxThreads < 1 || config.options.repetitions <= 0 || config.options.warmup < 0) {
+        cerr << "Размер, потоки и повторы должны быть положительными" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {                   // Основная функция
+    Config config;
+    config.options.repetitions = 5;
+    config.options.warmup = 1;
+    if (!parseArgs(argc, argv, config)) return 1;
+
+    vector<int> data = generateArray(config.n, Distribution::Uniform, 0, 99999);
+    long long expected = sumSequential(data);
+    uint32_t wrapped = 0;                           // 32-битная сумма с переносом, как int в блокнотах
+    for (int x : data) wrapped += static_cast<uint32_t>(x);
+    int32_t sum32 = static_cast<int32_t>(wrapped);
+
+    cout << "n = " << config.n << ", узлов NUMA: " << numaNodeCount() << ", повторов: " << config.options.repetitions
+         << " (прогрев " << config.options.warmup << ")" << endl;
+    cout << "Сумма (64 бита): " << expected << ", сумма в int: " << sum32
+         << (sum32 == expected ? " (совпадает)" : " (переполнение)") << endl << endl;
+
+    const BenchmarkOptions& opt = config.options;
+    size_t n = config.n;
+    size_t bytes = n * sizeof(int);
+    vector<BenchmarkResult> results;
+    bool ok = true;
+
+    for (int p : threadSweep(config.maxThreads)) {
+        omp_set_num_threads(p);
+        string g = "contention p=" + to_string(p);
+        long long sum = 0;
+        auto bench = [&](const string& name, long long (*kernel)(const vector<int>&)) {
+            addResult(results, runBenchmark(g, name, n, bytes, opt, [&] { sum = kernel(data); doNotOptimize(sum); }));
+            if (sum != expected) {
+                cerr << "ОШИБКА: " << name << " на " << p << " потоках: " << sum << " вместо " << expected << endl;
+                ok = false;
+            }
+        };
+        bench("sequential", sumSequential);
+        bench("atomic per element", sumAtomicPerElement);
+        bench("critical per element", sumCriticalPerElement);
+        bench("critical per thread", sumCriticalPerThread);
+        bench("omp reduction", sumOmpReduction);
+        bench("tree (hierarchical)", [](const vector<int>& a) { return hierarchicalSum(a); });
+    }
+
+    printBenchmarkTable(results, cout);
+
+    ok = writeResultFiles(results, config.csvPath, config.jsonPath) && ok;
+    return ok ? 0 : 1;                              // Ненулевой код, если какая-то сумма неверна
+}
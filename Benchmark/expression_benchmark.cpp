@@ -0,0 +1,212 @@
+// Benchmark: цепочки map-ядер отдельными проходами против одного прохода ленивого выражения (Common/expression.h)
+// Ядра Assignment_3 — multiply (arr * k), vector_add (A + B), coalesced_kernel (input * 2 + 1) — каждое читает и пишет
+// весь массив. Здесь те же операции, соединённые в цепочки, замеряются двумя способами:
+//   - separate — каждое ядро отдельным omp parallel for simd с промежуточным массивом (как запуск ядер подряд);
+//   - expression — то же выражение через expression.h: один проход, промежуточных массивов нет;
+//   - hand-fused — тот же один проход, написанный руками (показывает, что выражение не добавляет накладных расходов).
+// Цепочки:
+//   - chain: out = (a * k + b) * 2 + 1 — multiply, vector_add и coalesced_kernel;
+//   - where: out = a > 0 ? a * k : b — маска, умножение и выбор;
+//   - sum:   сумма (a * k + b) — multiply, vector_add и редукция.
+// GB/s считается по байтам, которые вариант действительно читает и пишет (у separate — вместе с промежуточными
+// массивами), поэтому ускорение expression примерно равно отношению объёмов трафика, если массивы не помещаются в кэш.
+// Результаты expression и hand-fused сверяются с separate (относительная погрешность 1e-5: компилятор может слить
+// умножение и сложение в одну FMA-инструкцию только в слитом цикле).
+//
+// Компиляция: g++ -std=c++17 -O3 -march=native -fopenmp expression_benchmark.cpp -o expression_benchmark
+// Запуск:     ./expression_benchmark [--sizes 1000000,10000000] [--k 3] [--threads 8] [--reps 10] [--warmup 2]
+//                                    [--csv results.csv] [--json results.json]
+
+#include <iostream>      // Для работы с вводом/выводом (cout, cerr, endl)
+#include <sstream>       // Для разбора списка размеров
+#include <iomanip>       // Для setprecision
+#include <string>        // Для аргументов командной строки
+#include <vector>        // Для массивов
+#include <cmath>         // Для fabs
+#include <cstdint>       // Для uint8_t
+#include <cstdlib>       // Для strtoull / atoi / atof
+#include <omp.h>         // Для OpenMP
+#include "../Common/benchmark.h"       // Замер с прогревом, повторами и статистикой
+#include "../Common/data_generator.h"  // Параллельная генерация массивов
+#include "../Common/reduction.h"       // Для parallelSum
+#include "../Common/expression.h"      // Ленивые поэлементные выражения
+
+using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
+
+const double EXPRESSION_TOLERANCE = 1e-5;    // Допустимая относительная погрешность (FMA в слитом цикле)
+
+// Параметры запуска (--reps, --warmup, --csv, --json — в BenchmarkArgs)
+struct Config : BenchmarkArgs {
+    vector<size_t> sizes = {1000000, 10000000};   // Размеры массивов (как n в Assignment3 и больше кэша)
+    float k = 3.0f;                               // Множитель multiply
+};
+
+// Отдельные ядра — по одному проходу каждое
+void multiplyPass(const float* a, float k, float* c, size_t n) {       // multiply_global
+    #pragma omp parallel for simd schedule(static)
+    for (size_t i = 0; i < n; ++i) c[i] = a[i] * k;
+}
+
+void addPass(const float* a, const float* b, float* c, size_t n) {     // vector_add
+    #pragma omp parallel for simd schedule(static)
+    for (size_t i = 0; i < n; ++i) c[i] = a[i] + b[i];
+}
+
+void affinePass(const float* in, float* out, size_t n) {               // coalesced_kernel: input * 2 + 1
+    #pragma omp parallel for simd schedule(static)
+    for (size_t i = 0; i < n; ++i) out[i] = in[i] * 2.0f + 1.0f;
+}
+
+void positivePass(const float* a, uint8_t* mask, size_t n) {           // Маска a > 0
+    #pragma omp parallel for simd schedule(static)
+    for (size_t i = 0; i < n; ++i) mask[i] = a[i] > 0.0f;
+}
+
+void selectPass(const uint8_t* mask, const float* x, const float* y, float* out, size_t n) {
+    #pragma omp parallel for simd schedule(static)
+    for (size_t i = 0; i < n; ++i) out[i] = mask[i] ? x[i] : y[i];
+}
+
+// Совпадение массивов с относительной погрешностью
+bool closeArrays(const vector<float>& x, const vector<float>& y) {
+    if (x.size() != y.size()) return false;
+    size_t wrong = 0;
+    #pragma omp parallel for reduction(+ : wrong)
+    for (size_t i = 0; i < x.size(); ++i) {
+        double scale = max(1.0, static_cast<double>(fabs(y[i])));
+        if (fabs(static_cast<double>(x[i]) - y[i]) > EXPRESSION_TOLERANCE * scale) ++wrong;
+    }
+    return wrong == 0;
+}
+
+// Строки одного размера; false, если какой-то результат неверен
+bool compareChains(size_t n, const Config& config, vector<BenchmarkResult>& results) {
+    const BenchmarkOptions& opt = config.options;
+    float k = config.k;
+    vector<float> a = generateArray(n, Distribution::Uniform, -1.0f, 1.0f);
+    vector<float> b = generateArray(n, Distribution::Uniform, -1.0f, 1.0f, GENERATOR_DEFAULT_SEED + 1);
+    vector<float> t1(n), t2(n), reference(n), out(n);
+    vector<uint8_t> mask(n);
+    const size_t f = sizeof(float);
+    bool ok = true;
+
+    auto check = [&](const string& group, const string& name, bool correct) {
+        if (!correct) {
+            cerr << "ОШИБКА: " << group << " " << name << ": результат не совпадает с separate" << endl;
+            ok = false;
+        }
+    };
+    auto traffic = [&](const string& group, size_t separateBytes, size_t fusedBytes) {
+        cout << group << ": трафик separate " << separateBytes / n << " Б/элемент, expression " << fusedBytes / n
+             << " Б/элемент (в " << setprecision(3) << static_cast<double>(separateBytes) / fusedBytes << " раза меньше)"
+             << endl;
+    };
+
+    // chain: a * k -> t1; t1 + b -> t2; t2 * 2 + 1 -> out
+    string g = "chain n=" + to_string(n);
+    size_t separateBytes = 2 * n * f + 3 * n * f + 2 * n * f, fusedBytes = 3 * n * f;
+    addResult(results, runBenchmark(g, "separate", n, separateBytes, opt, [&] {
+        multiplyPass(a.data(), k, t1.data(), n);
+        addPass(t1.data(), b.data(), t2.data(), n);
+        affinePass(t2.data(), reference.data(), n);
+        doNotOptimize(reference.data());
+    }));
+    addResult(results, runBenchmark(g, "expression", n, fusedBytes, opt, [&] {
+        evaluate((lazy(a) * k + lazy(b)) * 2.0f + 1.0f, out);
+        doNotOptimize(out.data());
+    }));
+    check(g, "expression", closeArrays(out, reference));
+    addResult(results, runBenchmark(g, "hand-fused", n, fusedBytes, opt, [&] {
+        const float* pa = a.data();
+        const float* pb = b.data();
+        float* po = out.data();
+        #pragma omp parallel for simd schedule(static)
+        for (size_t i = 0; i < n; ++i) po[i] = (pa[i] * k + pb[i]) * 2.0f + 1.0f;
+        doNotOptimize(out.data());
+    }));
+    check(g, "hand-fused", closeArrays(out, reference));
+    traffic(g, separateBytes, fusedBytes);
+
+    // where: маска a > 0 -> mask; a * k -> t1; mask ? t1 : b -> out
+    g = "where n=" + to_string(n);
+    separateBytes = (f + 1) * n + 2 * n * f + (1 + 3 * f) * n;
+    addResult(results, runBenchmark(g, "separate", n, separateBytes, opt, [&] {
+        positivePass(a.data(), mask.data(), n);
+        multiplyPass(a.data(), k, t1.data(), n);
+        selectPass(mask.data(), t1.data(), b.data(), reference.data(), n);
+        doNotOptimize(reference.data());
+    }));
+    addResult(results, runBenchmark(g, "expression", n, fusedBytes, opt, [&] {
+        evaluate(where(lazy(a) > 0.0f, lazy(a) * k, lazy(b)), out);
+        doNotOptimize(out.data());
+    }));
+    check(g, "expression", closeArrays(out, reference));
+    traffic(g, separateBytes, fusedBytes);
+
+    // sum: a * k -> t1; t1 + b -> t2; parallelSum(t2)
+    g = "sum n=" + to_string(n);
+    separateBytes = 2 * n * f + 3 * n * f + n * f;
+    fusedBytes = 2 * n * f;
+    double separateSum = 0, fusedSum = 0;
+    addResult(results, runBenchmark(g, "separate", n, separateBytes, opt, [&] {
+        multiplyPass(a.data(), k, t1.data(), n);
+        addPass(t1.data(), b.data(), t2.data(), n);
+        separateSum = parallelSum(t2);
+        doNotOptimize(separateSum);
+    }));
+    addResult(results, runBenchmark(g, "expression", n, fusedBytes, opt, [&] {
+        fusedSum = sumOf(lazy(a) * k + lazy(b));
+        doNotOptimize(fusedSum);
+    }));
+    double bound = EXPRESSION_TOLERANCE * n * (fabs(k) + 1);      // Относительно суммы модулей (|a|, |b| <= 1)
+    check(g, "expression", fabs(fusedSum - separateSum) <= bound);
+    traffic(g, separateBytes, fusedBytes);
+    cout << endl;
+    return ok;
+}
+
+bool parseArgs(int argc, char** argv, Config& config) {
+    bool parsed = parseBenchmarkArgs(argc, argv, config, [&](const string& arg, const string& value) {
+        if (arg == "--sizes") {
+            config.sizes.clear();
+            stringstream list(value);
+            string item;
+            while (getline(list, item, ',')) config.sizes.push_back(strtoull(item.c_str(), nullptr, 10));
+        }
+        else if (arg == "--k") config.k = static_cast<float>(atof(value.c_str()));
+        else if (arg == "--threads") omp_set_num_threads(atoi(value.c_str()));
+        else return FlagStatus::Unknown;
+        return FlagStatus::Ok;
+    });
+    if (!parsed) return false;
+    for (size_t n : config.sizes) {
+        if (n == 0) {
+            cerr << "Размеры должны быть положительными" << endl;
+            return false;
+        }
+    }
+    if (config.sizes.empty() || config.options.repetitions <= 0 || config.options.warmup < 0) {
+        cerr << "Нужны размеры и повторы больше нуля" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {                   // Основная функция
+    Config config;
+    if (!parseArgs(argc, argv, config)) return 1;
+
+    cout << "Потоков OpenMP: " << omp_get_max_threads() << ", k = " << config.k << ", повторов: "
+         << config.options.repetitions << " (прогрев " << config.options.warmup << ")" << endl << endl;
+
+    vector<BenchmarkResult> results;
+    bool ok = true;
+    for (size_t n : config.sizes) {
+        ok = compareChains(n, config, results) && ok;
+    }
+    printBenchmarkTable(results, cout);
+    cout << (ok ? "Все результаты совпадают с separate" : "Есть неверные результаты") << endl;
+
+    ok = writeResultFiles(results, config.csvPath, config.jsonPath) && ok;
+    return ok ? 0 : 1;                              // Ненулевой код, если какой-то результат неверен
+}
@@ -0,0 +1,206 @@
+// Benchmark: внешняя сортировка двоичного файла больше бюджета памяти (Common/external_sort.h)
+// Программа сортирует файл int32 / int64 (значения подряд, порядок байт машины). Без --input файл сначала генерируется
+// (Common/data_generator.h кусками: генерация следующего куска идёт, пока пишется предыдущий), поэтому сортировку
+// файлов в несколько ГБ можно проверить на своей машине: --count 1000000000 --type int32 — 4 ГБ.
+// Печатается время фаз (генерация, серии, слияние) и скорость в МБ входа в секунду. Результат проверяется потоковым
+// чтением: файл отсортирован, число элементов и контрольная сумма (сумма хешей значений, не зависит от порядка)
+// совпадают со входом; при ошибке код возврата 1. Временные файлы удаляются; сгенерированный вход и результат по
+// умолчанию — тоже (--keep yes оставляет их).
+// Временные файлы нужно класть на диск (--temp): /tmp часто лежит в памяти (tmpfs), и тогда замер теряет смысл.
+//
+// Компиляция: g++ -std=c++17 -O3 -march=native -fopenmp external_sort.cpp -o external_sort -pthread
+// Запуск:     ./external_sort [--count 100000000] [--type int32|int64] [--dist uniform] [--memory-mb 256] [--temp .]
+//                             [--input data.bin] [--output sorted.bin] [--threads 8] [--keep no]
+
+#include <iostream>      // Для работы с вводом/выводом (cout, cerr, endl)
+#include <iomanip>       // Для setprecision
+#include <string>        // Для аргументов командной строки
+#include <vector>        // Для буферов
+#include <future>        // Для фоновой записи при генерации
+#include <chrono>        // Для steady_clock
+#include <limits>        // Для numeric_limits
+#include <cstdio>        // Для remove
+#include <cstdint>       // Для uint64_t
+#include <cstdlib>       // Для strtoull / atoi
+#include <omp.h>         // Для OpenMP
+#include "../Common/data_generator.h"  // Генерация кусков массива (generateArraySlice)
+#include "../Common/external_sort.h"   // Внешняя сортировка слиянием
+#include "../Common/benchmark.h"       // Разбор аргументов (parseFlags)
+
+using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
+
+const size_t CHECK_BLOCK = 16 << 20;              // Байт за одно чтение при проверке
+
+// Параметры запуска
+struct Config {
+    string input;                                 // Файл для сортировки (пусто — сгенерировать)
+    string output;                                // Результат (пусто — рядом с временными файлами)
+    string type = "int32";                        // int32 или int64
+    uint64_t count = 100000000;                   // Элементов в генерируемом файле (400 МБ int32)
+    Distribution dist = Distribution::Uniform;    // Распределение генерируемых значений
+    bool keep = false;                            // Оставить сгенерированный вход и результат
+    ExternalSortOptions options;                  // Бюджет памяти и каталог временных файлов
+};
+
+// Сводка файла: число элементов, контрольная сумма (не зависит от порядка) и отсортированность
+struct FileSummary {
+    uint64_t count = 0;
+    uint64_t checksum = 0;
+    bool sorted = true;
+};
+
+// Добавить кусок к сводке; previous — последний элемент предыдущего куска (hasPrevious — он есть)
+template <typename T>
+void addToSummary(FileSummary& summary, const T* data, size_t n, T& previous, bool& hasPrevious) {
+    if (n == 0) return;
+    uint64_t checksum = 0;
+    size_t descents = 0;
+    #pragma omp parallel for reduction(+ : checksum, descents)
+    for (size_t i = 0; i < n; ++i) {
+        checksum += splitMix64(static_cast<uint64_t>(data[i]));
+        if (i > 0 && data[i] < data[i - 1]) ++descents;
+    }
+    if (hasPrevious && data[0] < previous) ++descents;
+    summary.count += n;
+    summary.checksum += checksum;
+    summary.sorted = summary.sorted && descents == 0;
+    previous = data[n - 1];
+    hasPrevious = true;
+}
+
+// Потоковая сводка файла
+template <typename T>
+FileSummary summarizeFile(const string& path) {
+    BinaryFile file(path, BinaryFile::Mode::Read);
+    uint64_t n = file.size() / sizeof(T);
+    vector<T> block(CHECK_BLOCK / sizeof(T));
+    FileSummary summary;
+    T previous = T();
+    bool hasPrevious = false;
+    for (uint64_t first = 0; first < n; first += block.size()) {
+        size_t count = static_cast<size_t>(min<uint64_t>(block.size(), n - first));
+        file.read(block.data(), count * sizeof(T), first * sizeof(T));
+        addToSummary(summary, block.data(), count, previous, hasPrevious);
+    }
+    return summary;
+}
+
+// Генерация файла из n элементов кусками по бюджету памяти; возвращает сводку записанных данных
+template <typename T>
+FileSummary generateFile(const string& path, uint64_t n, Distribution dist, size_t memoryBytes) {
+    BinaryFile file(path, BinaryFile::Mode::Write);
+    size_t chunk = max<size_t>(memoryBytes / (2 * sizeof(T)), 1);    // Два буфера: один пишется, другой заполняется
+    vector<T> buffers[2] = {vector<T>(min<uint64_t>(chunk, n)), vector<T>(min<uint64_t>(chunk, n))};
+    FileSummary summary;
+    T previous = T();
+    bool hasPrevious = false;
+    future<void> writing;
+    int current = 0;
+    for (uint64_t first = 0; first < n; first += chunk) {
+        size_t count = static_cast<size_t>(min<uint64_t>(chunk, n - first));
+        T* data = buffers[current].data();
+        generateArraySlice(data, static_cast<size_t>(first), count, static_cast<size_t>(n), dist,
+                           numeric_limits<T>::min(), numeric_limits<T>::max());
+        addToSummary(summary, data, count, previous, hasPrevious);
+        if (writing.valid()) writing.get();                         // Второй буфер снова свободен
+        const BinaryFile* target = &file;
+        writing = async(launch::async, [target, data, count, first] { target->write(data, count * sizeof(T), first * sizeof(T)); });
+        current ^= 1;
+    }
+    if (writing.valid()) writing.get();
+    return summary;
+}
+
+double megabytes(uint64_t bytes) { return static_cast<double>(bytes) / (1 << 20); }
+
+template <typename T>
+int run(const Config& config) {
+    const string tempDir = config.options.tempDir.empty() ? string(".") : config.options.tempDir;
+    string input = config.input.empty() ? tempDir + "/external_input_" + config.type + ".bin" : config.input;
+    string output = config.output.empty() ? tempDir + "/external_sorted_" + config.type + ".bin" : config.output;
+    cout << "Тип: " << config.type << ", бюджет памяти: " << config.options.memoryBytes / (1 << 20) << " МБ, потоков OpenMP: "
+         << omp_get_max_threads() << ", временные файлы: " << tempDir << endl;
+
+    FileSummary before;
+    auto start = chrono::steady_clock::now();
+    if (config.input.empty()) {
+        before = generateFile<T>(input, config.count, config.dist, config.options.memoryBytes);
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << "Генерация (" << distributionName(config.dist) << "): " << fixed << setprecision(2) << seconds << " с, "
+             << setprecision(0) << megabytes(before.count * sizeof(T)) / seconds << " МБ/с" << endl;
+    } else {
+        before = summarizeFile<T>(input);
+    }
+    uint64_t bytes = before.count * sizeof(T);
+    cout << "Вход: " << input << ", " << before.count << " элементов (" << fixed << setprecision(1) << megabytes(bytes)
+         << " МБ)" << endl;
+
+    ExternalSortStats stats = externalSort<T>(input, output, config.options);
+    double total = stats.runSeconds + stats.mergeSeconds;
+    cout << setprecision(2);
+    cout << "Серии: " << stats.runs << " по " << stats.runElements << " элементов, " << stats.runSeconds << " с, "
+         << setprecision(0) << megabytes(bytes) / stats.runSeconds << " МБ/с" << endl;
+    cout << setprecision(2) << "Слияние: проходов " << stats.mergePasses << ", серий за раз " << stats.fanIn << ", блок "
+         << stats.blockElements * sizeof(T) / 1024 << " КБ, " << stats.mergeSeconds << " с";
+    if (stats.mergePasses > 0) cout << ", " << setprecision(0) << megabytes(bytes) * stats.mergePasses / stats.mergeSeconds << " МБ/с";
+    cout << endl;
+    cout << setprecision(2) << "Всего: " << total << " с, " << setprecision(0) << megabytes(bytes) / total << " МБ/с" << endl;
+
+    FileSummary after = summarizeFile<T>(output);
+    bool ok = after.sorted && after.count == before.count && after.checksum == before.checksum;
+    if (!after.sorted) cerr << "ОШИБКА: результат не отсортирован" << endl;
+    if (after.count != before.count || after.checksum != before.checksum) {
+        cerr << "ОШИБКА: набор значений результата не совпадает со входом" << endl;
+    }
+    cout << (ok ? "Результат отсортирован, набор значений совпадает со входом" : "Результат неверен") << endl;
+
+    if (!config.keep) {
+        if (config.input.empty()) remove(input.c_str());
+        if (config.output.empty()) remove(output.c_str());
+    } else {
+        cout << "Результат: " << output << endl;
+    }
+    return ok ? 0 : 1;                              // Ненулевой код, если результат неверен
+}
+
+bool parseArgs(int argc, char** argv, Config& config) {
+    bool parsed = parseFlags(argc, argv, [&](const string& arg, const string& value) {
+        if (arg == "--input") config.input = value;
+        else if (arg == "--output") config.output = value;
+        else if (arg == "--temp") config.options.tempDir = value;
+        else if (arg == "--type") config.type = value;
+        else if (arg == "--count") config.count = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--memory-mb") config.options.memoryBytes = static_cast<size_t>(strtoull(value.c_str(), nullptr, 10)) << 20;
+        else if (arg == "--threads") omp_set_num_threads(atoi(value.c_str()));
+        else if (arg == "--keep") config.keep = value == "yes";
+        else if (arg == "--dist") {
+            if (!parseDistribution(value, config.dist)) {
+                cerr << "Неизвестное распределение: " << value << endl;
+                return FlagStatus::Invalid;
+            }
+        }
+        else return FlagStatus::Unknown;
+        return FlagStatus::Ok;
+    });
+    if (!parsed) return false;
+    if (config.type != "int32" && config.type != "int64") {
+        cerr << "Тип должен быть int32 или int64" << endl;
+        return false;
+    }
+    if (config.options.memoryBytes < 2 * EXTERNAL_MERGE_BLOCKS * EXTERNAL_MIN_BLOCK) {
+        cerr << "Бюджет памяти должен быть не меньше " << 2 * EXTERNAL_MERGE_BLOCKS * EXTERNAL_MIN_BLOCK / (1 << 20) << " МБ" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {                   // Основная функция
+    Config config;
+    if (!parseArgs(argc, argv, config)) return 1;
+    try {
+        return config.type == "int64" ? run<long long>(config) : run<int>(config);
+    } catch (const exception& e) {                  // Ошибки ввода-вывода и неверный размер файла
+        cerr << "ОШИБКА: " << e.what() << endl;
+        return 1;
+    }
+}
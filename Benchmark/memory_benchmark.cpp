@@ -0,0 +1,297 @@
+// Benchmark: шаблоны доступа к памяти на CPU — последовательный, с шагом, случайная выборка (gather) и блочная выборка
+// Assignment3_task3 сравнивал на GPU output[idx] = input[idx] * 2 + 1 и тот же код с input[(idx * 997) % N] одним
+// замером без объяснения разницы. Здесь то же ядро out[i] = in[j] * 2 + 1 (int) замеряется на CPU для рабочих наборов
+// от L1 до размеров больше L3, по числу потоков и размеру страниц:
+//   - sequential — j = i (эталон группы);
+//   - stride S — j = (i * S) % n, как bad_idx в Assignment3 (по умолчанию S = 997); индекс считается сложением;
+//   - random — j = idx[i], idx — случайные индексы из [0, n) (кроме in и out читается ещё и idx);
+//   - blocked — те же случайные индексы, но пары (i, idx[i]) заранее (inspector, не замеряется) разложены по окнам
+//     входа размером --block-kb: чтение внутри окна попадает в кэш, а случайной становится запись;
+//   - + prefetch — для stride и random __builtin_prefetch элемента на --prefetch итераций вперёд;
+//   - страницы 4 КБ и 2 МБ (Common/page_buffer.h): при случайном доступе число страниц рабочего набора сравнивается
+//     с числом записей TLB, печатается и доля набора, которую ядро действительно отдало большими страницами.
+// Рабочий набор — размер входного массива in; уровень (L1 / L2 / L3 / DRAM) определяется по размерам кэшей из sysfs
+// (Common/topology.h). Маленькие наборы проходятся несколько раз за замер (всего не меньше 64 МБ чтения), чтобы время
+// было много больше разрешения таймера. GB/s — прочитанные и записанные байты (in, out, idx или план) за медиану.
+// Массивы заполняются параллельно теми же потоками (first touch), результат каждого ядра проверяется полностью.
+//
+// Компиляция: g++ -std=c++17 -O3 -march=native -fopenmp memory_benchmark.cpp -o memory_benchmark
+// Запуск:     ./memory_benchmark [--min-kb 16] [--max-mb 256] [--stride 997] [--prefetch 32] [--block-kb 256]
+//                                [--pages 4k|2m|both] [--max-threads 8] [--only random] [--reps 5] [--warmup 1]
+//                                [--csv results.csv] [--json results.json]
+
+#include <iostream>      // Для работы с вводом/выводом (cout, cerr, endl)
+#include <iomanip>       // Для setw / setprecision
+#include <string>        // Для аргументов командной строки
+#include <vector>        // Для списков размеров и результатов
+#include <cstdint>       // Для uint32_t / uint64_t
+#include <cstdlib>       // Для strtoull / atoi
+#include <omp.h>         // Для OpenMP
+#include "../Common/benchmark.h"       // Замер с прогревом, повторами и статистикой
+#include "../Common/data_generator.h"  // Счётчиковый генератор
+#include "../Common/reduction.h"       // Для threadRange
+#include "../Common/scaling.h"         // Для threadSweep
+#include "../Common/topology.h"        // Размеры кэшей
+#include "../Common/page_buffer.h"     // Буферы со страницами 4 КБ / 2 МБ
+
+using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
+
+const size_t MIN_BYTES_PER_SAMPLE = 64 << 20;  // Чтения за один замер не меньше (повторные проходы малых наборов)
+
+// Параметры запуска (--reps, --warmup, --csv, --json — в BenchmarkArgs)
+struct Config : BenchmarkArgs {
+    size_t minKb = 16;                            // Наименьший рабочий набор
+    size_t maxMb = 256;                           // Наибольший рабочий набор
+    size_t stride = 997;                          // Шаг, как в Assignment3_task3
+    size_t prefetch = 32;                         // Дистанция предвыборки в итерациях (0 — без строк + prefetch)
+    size_t blockKb = 256;                         // Окно входа для блочной выборки
+    vector<PageMode> pages = {PageMode::Small, PageMode::Huge};
+    int maxThreads = omp_get_max_threads();       // Потоков в переборе: 1, 2, 4, ..., maxThreads
+    string only;                                  // Запускать только шаблоны, имя которых начинается с этой строки
+};
+
+// Массивы одного рабочего набора
+struct Arrays {
+    size_t n = 0;
+    int* in = nullptr;
+    int* out = nullptr;
+    uint32_t* idx = nullptr;                      // Случайные индексы для random
+    uint32_t* planDst = nullptr;                  // План blocked: out[planDst[k]] = in[planSrc[k]] * 2 + 1
+    uint32_t* planSrc = nullptr;
+};
+
+// sequential: out[i] = in[i] * 2 + 1
+void sequentialPass(const Arrays& a) {
+    const int* in = a.in;
+    int* out = a.out;
+    #pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < a.n; ++i) out[i] = in[i] * 2 + 1;
+}
+
+// stride: out[i] = in[(i * stride) % n]; каждый поток считает индекс своего куска сложением по модулю
+void stridePass(const Arrays& a, size_t stride, size_t distance) {
+    const int* in = a.in;
+    int* out = a.out;
+    size_t n = a.n, step = stride % n;
+    #pragma omp parallel
+    {
+        size_t begin, end;
+        threadRange(n, omp_get_thread_num(), omp_get_num_threads(), begin, end);
+        size_t j = (begin % n) * step % n;
+        if (distance == 0) {
+            for (size_t i = begin; i < end; ++i) {
+                out[i] = in[j] * 2 + 1;
+                j += step;
+                if (j >= n) j -= n;
+            }
+        } else {
+            size_t ahead = ((begin + distance) % n) * step % n;  // Индекс на distance итераций вперёд
+            for (size_t i = begin; i < end; ++i) {
+                __builtin_prefetch(in + ahead, 0, 3);
+                out[i] = in[j] * 2 + 1;
+                j += step;
+                if (j >= n) j -= n;
+                ahead += step;
+                if (ahead >= n) ahead -= n;
+            }
+        }
+    }
+}
+
+// random: out[i] = in[idx[i]]
+void randomPass(const Arrays& a, size_t distance) {
+    const int* in = a.in;
+    const uint32_t* idx = a.idx;
+    int* out = a.out;
+    size_t n = a.n;
+    if (distance == 0) {
+        #pragma omp parallel for schedule(static)
+        for (size_t i = 0; i < n; ++i) out[i] = in[idx[i]] * 2 + 1;
+        return;
+    }
+    #pragma omp parallel
+    {
+        size_t begin, end;
+        threadRange(n, omp_get_thread_num(), omp_get_num_threads(), begin, end);
+        size_t last = end > distance ? end - distance : begin;   // Дальше предвыборка вышла бы за кусок
+        size_t i = begin;
+        for (; i < last; ++i) {
+            __builtin_prefetch(in + idx[i + distance], 0, 3);
+            out[i] = in[idx[i]] * 2 + 1;
+        }
+        for (; i < end; ++i) out[i] = in[idx[i]] * 2 + 1;
+    }
+}
+
+// blocked: план отсортирован по окнам входа, потоки получают подряд идущие части плана
+void blockedPass(const Arrays& a) {
+    const int* in = a.in;
+    const uint32_t* dst = a.planDst;
+    const uint32_t* src = a.planSrc;
+    int* out = a.out;
+    #pragma omp parallel for schedule(static)
+    for (size_t k = 0; k < a.n; ++k) out[dst[k]] = in[src[k]] * 2 + 1;
+}
+
+// Inspector для blocked: устойчивая сортировка подсчётом пар (i, idx[i]) по номеру окна idx[i] / window
+void buildBlockedPlan(const Arrays& a, size_t window) {
+    size_t windows = (a.n + window - 1) / window;
+    vector<size_t> start(windows + 1, 0);
+    for (size_t i = 0; i < a.n; ++i) ++start[a.idx[i] / window + 1];
+    for (size_t w = 0; w < windows; ++w) start[w + 1] += start[w];
+    for (size_t i = 0; i < a.n; ++i) {
+        size_t k = start[a.idx[i] / window]++;
+        a.planDst[k] = static_cast<uint32_t>(i);
+        a.planSrc[k] = a.idx[i];
+    }
+}
+
+// Полная проверка: out[i] == in[source(i)] * 2 + 1
+template <typename Source>
+bool verify(const Arrays& a, Source source) {
+    size_t wrong = 0;
+    #pragma omp parallel for schedule(static) reduction(+ : wrong)
+    for (size_t i = 0; i < a.n; ++i) {
+        if (a.out[i] != a.in[source(i)] * 2 + 1) ++wrong;
+    }
+    return wrong == 0;
+}
+
+// "16KB", "4MB"
+string formatBytes(size_t bytes) {
+    return bytes >= (1 << 20) && bytes % (1 << 20) == 0 ? to_string(bytes >> 20) + "MB" : to_string(bytes >> 10) + "KB";
+}
+
+// Замеры одного рабочего набора в одном режиме страниц; false, если какой-то результат неверен
+bool runWorkingSet(size_t bytes, PageMode mode, const Config& config, const vector<CacheLevel>& caches,
+                   vector<BenchmarkResult>& results) {
+    const BenchmarkOptions& opt = config.options;
+    Arrays a;
+    a.n = bytes / sizeof(int);
+    PageBuffer in(a.n * sizeof(int), mode), out(a.n * sizeof(int), mode), idx(a.n * sizeof(uint32_t), mode);
+    PageBuffer planDst(a.n * sizeof(uint32_t), mode), planSrc(a.n * sizeof(uint32_t), mode);
+    a.in = in.as<int>();
+    a.out = out.as<int>();
+    a.idx = idx.as<uint32_t>();
+    a.planDst = planDst.as<uint32_t>();
+    a.planSrc = planSrc.as<uint32_t>();
+
+    // Первое касание всех массивов всеми потоками (schedule(static) — те же куски, что в ядрах)
+    omp_set_num_threads(config.maxThreads);
+    generateArraySlice(a.in, 0, a.n, a.n, Distribution::Uniform, 0, 1 << 20);
+    #pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < a.n; ++i) {
+        a.out[i] = 0;
+        a.idx[i] = static_cast<uint32_t>(counterRandom(GENERATOR_DEFAULT_SEED + 1, i) % a.n);
+        a.planDst[i] = a.planSrc[i] = 0;
+    }
+    size_t window = config.blockKb * 1024 / sizeof(int);
+    buildBlockedPlan(a, window);
+
+    string level = memoryLevelName(bytes, caches);
+    string group = string(pageModeName(mode)) + " " + formatBytes(bytes) + " " + level;
+    size_t passes = bytes >= MIN_BYTES_PER_SAMPLE ? 1 : MIN_BYTES_PER_SAMPLE / bytes;
+    double hugeShare = static_cast<double>(hugePageBytes(in)) / in.bytes();
+    cout << left << setw(20) << group << right << setw(10) << (bytes + SMALL_PAGE_SIZE - 1) / SMALL_PAGE_SIZE
+         << setw(10) << (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE << setw(12) << fixed << setprecision(0)
+         << hugeShare * 100 << "%" << setw(10) << passes << endl;
+    cout.unsetf(ios::fixed);
+
+    size_t stride = config.stride, distance = config.prefetch, n = a.n;
+    bool ok = true;
+    auto row = [&](const string& name, size_t bytesPerElement, auto pass, auto source) {
+        if (!config.only.empty() && name.compare(0, config.only.size(), config.only) != 0) return;
+        for (int threads : threadSweep(config.maxThreads)) {
+            omp_set_num_threads(threads);
+            #pragma omp parallel for schedule(static)
+            for (size_t i = 0; i < n; ++i) a.out[i] = -1;
+            addResult(results, runBenchmark(group, name, n * passes, n * bytesPerElement * passes, opt, [&] {
+                for (size_t p = 0; p < passes; ++p) pass();
+                doNotOptimize(a.out);
+            }));
+            if (!verify(a, source)) {
+                cerr << "ОШИБКА: " << group << " " << name << " (" << threads << " потоков): неверный результат" << endl;
+                ok = false;
+            }
+        }
+    };
+
+    auto identity = [](size_t i) { return i; };
+    auto strided = [&](size_t i) { return (i % n) * (stride % n) % n; };
+    auto gathered = [&](size_t i) { return static_cast<size_t>(a.idx[i]); };
+    string strideName = "stride " + to_string(stride);
+    row("sequential", 2 * sizeof(int), [&] { sequentialPass(a); }, identity);
+    row(strideName, 2 * sizeof(int), [&] { stridePass(a, stride, 0); }, strided);
+    if (distance > 0) row(strideName + " + prefetch", 2 * sizeof(int), [&] { stridePass(a, stride, distance); }, strided);
+    row("random", 2 * sizeof(int) + sizeof(uint32_t), [&] { randomPass(a, 0); }, gathered);
+    if (distance > 0) {
+        row("random + prefetch", 2 * sizeof(int) + sizeof(uint32_t), [&] { randomPass(a, distance); }, gathered);
+    }
+    row("blocked " + formatBytes(window * sizeof(int)), 2 * sizeof(int) + 2 * sizeof(uint32_t),
+        [&] { blockedPass(a); }, gathered);
+    return ok;
+}
+
+bool parseArgs(int argc, char** argv, Config& config) {
+    bool parsed = parseBenchmarkArgs(argc, argv, config, [&](const string& arg, const string& value) {
+        if (arg == "--min-kb") config.minKb = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--max-mb") config.maxMb = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--stride") config.stride = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--prefetch") config.prefetch = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--block-kb") config.blockKb = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--pages") {
+            PageMode mode;
+            if (value == "both") config.pages = {PageMode::Small, PageMode::Huge};
+            else if (parsePageMode(value, mode)) config.pages = {mode};
+            else {
+                cerr << "Неизвестный режим страниц: " << value << endl;
+                return FlagStatus::Invalid;
+            }
+        }
+        else if (arg == "--max-threads") config.maxThreads = atoi(value.c_str());
+        else if (arg == "--only") config.only = value;
+        else return FlagStatus::Unknown;
+        return FlagStatus::Ok;
+    });
+    if (!parsed) return false;
+    if (config.minKb == 0 || config.maxMb == 0 || config.minKb > config.maxMb * 1024 || config.maxMb > 4096) {
+        cerr << "Нужно 0 < --min-kb <= --max-mb * 1024 и --max-mb <= 4096 (индексы — uint32)" << endl;
+        return false;
+    }
+    if (config.stride == 0 || config.blockKb == 0 || config.maxThreads < 1 || config.options.repetitions <= 0
+        || config.options.warmup < 0) {
+        cerr << "Шаг, окно, потоки и повторы должны быть положительными" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {                   // Основная функция
+    Config config;
+    config.options.repetitions = 5;
+    config.options.warmup = 1;
+    if (!parseArgs(argc, argv, config)) return 1;
+
+    vector<CacheLevel> caches = dataCacheLevels();
+    cout << "Кэши данных:";
+    for (const CacheLevel& c : caches) cout << " L" << c.level << " " << formatBytes(c.bytes);
+    if (caches.empty()) cout << " неизвестны";
+    cout << "; потоков: до " << config.maxThreads << ", повторов: " << config.options.repetitions
+         << " (прогрев " << config.options.warmup << ")" << endl << endl;
+    cout << left << setw(20) << "working set" << right << setw(10) << "4K pages" << setw(10) << "2M pages"
+         << setw(13) << "in 2M pages" << setw(10) << "passes" << endl;
+
+    vector<BenchmarkResult> results;
+    bool ok = true;
+    for (PageMode mode : config.pages) {
+        for (size_t bytes = config.minKb << 10; bytes <= config.maxMb << 20; bytes *= 4) {
+            ok = runWorkingSet(bytes, mode, config, caches, results) && ok;
+        }
+    }
+    cout << endl;
+    printBenchmarkTable(results, cout);
+    cout << (ok ? "Все результаты проверены" : "Есть неверные результаты") << endl;
+
+    ok = writeResultFiles(results, config.csvPath, config.jsonPath) && ok;
+    return ok ? 0 : 1;                              // Ненулевой код, если какой-то результат неверен
+}
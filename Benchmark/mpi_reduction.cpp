@@ -0,0 +1,265 @@
+// Benchmark: распределённая сумма массива на MPI (замена assignment44.cpp из Assignment4_Task4)
+// В блокноте MPI_Scatter получал N / size элементов на процесс (остаток терялся), сумма считалась в int,
+// а замер начинался после рассылки и учитывал только время процесса 0. Здесь:
+//   - Scatterv: куски отличаются не больше чем на один элемент, остаток не теряется;
+//   - все суммы 64-битные (MPI_LONG_LONG) и сверяются с последовательным эталоном;
+//   - время запуска — от общего MPI_Barrier до конца операции на самом медленном процессе (максимум по процессам),
+//     в него входит рассылка данных;
+//   - режимы: root only (процесс 0 один, эталон ускорения), scatterv + reduce, scatterv + allreduce (результат у всех),
+//     local gen + reduce (каждый процесс генерирует свой кусок счётчиковым генератором — рассылки нет),
+//     pipelined iscatterv (кусок приходит частями через MPI_Iscatterv, пока считается предыдущая часть, частичные суммы
+//     отправляются MPI_Ireduce, не дожидаясь остальных);
+//   - гибрид MPI + OpenMP: внутри процесса сумма считается parallelSum на --threads потоках.
+//
+// Компиляция: mpicxx -std=c++17 -O3 -march=native -fopenmp mpi_reduction.cpp -o mpi_reduction
+// Запуск:     mpirun -np 4 ./mpi_reduction [--n 10000000] [--threads 1] [--chunks 8] [--reps 10] [--warmup 2]
+//                                          [--only scatterv] [--csv results.csv] [--json results.json]
+//             (в Colab: mpirun --allow-run-as-root --oversubscribe -np 4 ./mpi_reduction)
+
+#include <iostream>      // Для работы с вводом/выводом (cout, cerr, endl)
+#include <string>        // Для аргументов командной строки
+#include <vector>        // Для массивов
+#include <climits>       // Для INT_MAX
+#include <cstdint>       // Для int32_t / uint32_t
+#include <cstdlib>       // Для strtoull / atoi
+#include <mpi.h>         // MPI библиотека для распределённых вычислений
+#include <omp.h>         // Для OpenMP
+#include "../Common/benchmark.h"       // Статистика замеров, таблица, CSV / JSON
+#include "../Common/data_generator.h"  // Генерация массива и его кусков
+#include "../Common/reduction.h"       // Для parallelSum
+
+using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
+
+const int VALUE_MAX = 99999;                      // Значения массива из [0, VALUE_MAX]
+
+// Параметры запуска (--reps, --warmup, --csv, --json — в BenchmarkArgs)
+struct Config : BenchmarkArgs {
+    size_t n = 10000000;                          // Размер массива
+    int threads = 1;                              // Потоков OpenMP в каждом процессе
+    int chunks = 8;                               // Частей куска в режиме pipelined
+    string only;                                  // Только режимы, имя которых содержит строку
+};
+
+// Разбиение n элементов на parts кусков: первые n % parts кусков на один элемент длиннее
+struct Partition {
+    vector<int> counts;                           // Длины кусков
+    vector<int> displs;                           // Смещения кусков
+};
+
+Partition makePartition(size_t n, int parts) {
+    Partition p;
+    p.counts.resize(parts);
+    p.displs.resize(parts);
+    size_t offset = 0;
+    for (int r = 0; r < parts; ++r) {
+        size_t count = n / parts + (static_cast<size_t>(r) < n % parts ? 1 : 0);
+        p.counts[r] = static_cast<int>(count);
+        p.displs[r] = static_cast<int>(offset);
+        offset += count;
+    }
+    return p;
+}
+
+// Общее состояние процесса
+struct Context {
+    int rank = 0;
+    int size = 1;
+    size_t n = 0;
+    int chunks = 1;
+    vector<int> full;                             // Весь массив (только у процесса 0)
+    Partition part;                               // Куски процессов
+    vector<int> local;                            // Свой кусок
+    vector<int> stage[2];                         // Буферы частей для pipelined
+    vector<Partition> rounds;                     // Части кусков всех процессов по раундам pipelined
+};
+
+// РЕЖИМЫ (возвращают сумму на процессе 0; allreduce — на всех процессах)
+long long rootOnly(Context& ctx) {                // Эталон: процесс 0 суммирует весь массив, остальные ждут
+    return ctx.rank == 0 ? parallelSum(ctx.full.data(), ctx.n) : 0;
+}
+
+long long scattervReduce(Context& ctx) {
+    MPI_Scatterv(ctx.full.data(), ctx.part.counts.data(), ctx.part.displs.data(), MPI_INT,
+                 ctx.local.data(), ctx.part.counts[ctx.rank], MPI_INT, 0, MPI_COMM_WORLD);
+    long long localSum = parallelSum(ctx.local.data(), ctx.local.size());
+    long long globalSum = 0;
+    MPI_Reduce(&localSum, &globalSum, 1, MPI_LONG_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+    return globalSum;
+}
+
+long long scattervAllreduce(Context& ctx) {
+    MPI_Scatterv(ctx.full.data(), ctx.part.counts.data(), ctx.part.displs.data(), MPI_INT,
+                 ctx.local.data(), ctx.part.counts[ctx.rank], MPI_INT, 0, MPI_COMM_WORLD);
+    long long localSum = parallelSum(ctx.local.data(), ctx.local.size());
+    long long globalSum = 0;
+    MPI_Allreduce(&localSum, &globalSum, 1, MPI_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+    return globalSum;
+}
+
+long long localGenerationReduce(Context& ctx) {   // Генерация своего куска вместо рассылки (входит в замер)
+    generateArraySlice(ctx.local.data(), ctx.part.displs[ctx.rank], ctx.local.size(), ctx.n,
+                       Distribution::Uniform, 0, VALUE_MAX);
+    long long localSum = parallelSum(ctx.local.data(), ctx.local.size());
+    long long globalSum = 0;
+    MPI_Reduce(&localSum, &globalSum, 1, MPI_LONG_LONG, MPI_SUM, 0, MPI_COMM_WORLD);
+    return globalSum;
+}
+
+// Pipelined: раунд c рассылает c-ю часть куска каждого процесса; пока считается часть c, уже идёт рассылка c + 1,
+// а сумма части c отправляется MPI_Ireduce без ожидания. Все неблокирующие коллективные операции вызываются
+// всеми процессами в одном порядке, как требует MPI
+long long pipelined(Context& ctx) {
+    int rounds = ctx.chunks;
+    vector<long long> partial(rounds, 0), reduced(rounds, 0);
+    vector<MPI_Request> reduceRequests(rounds, MPI_REQUEST_NULL);
+    MPI_Request scatterRequest = MPI_REQUEST_NULL;
+
+    auto startScatter = [&](int c) {
+        const Partition& r = ctx.rounds[c];
+        MPI_Iscatterv(ctx.full.data(), r.counts.data(), r.displs.data(), MPI_INT,
+                      ctx.stage[c % 2].data(), r.counts[ctx.rank], MPI_INT, 0, MPI_COMM_WORLD, &scatterRequest);
+    };
+
+    startScatter(0);
+    for (int c = 0; c < rounds; ++c) {
+        MPI_Wait(&scatterRequest, MPI_STATUS_IGNORE);
+        if (c + 1 < rounds) startScatter(c + 1);                        // Буфер (c + 1) % 2 уже просуммирован
+        partial[c] = parallelSum(ctx.stage[c % 2].data(), ctx.rounds[c].counts[ctx.rank]);
+        MPI_Ireduce(&partial[c], &reduced[c], 1, MPI_LONG_LONG, MPI_SUM, 0, MPI_COMM_WORLD, &reduceRequests[c]);
+    }
+    MPI_Waitall(rounds, reduceRequests.data(), MPI_STATUSES_IGNORE);
+
+    long long globalSum = 0;
+    for (long long s : reduced) globalSum += s;
+    return globalSum;
+}
+
+// Замер режима: каждый запуск начинается общим барьером, время запуска — максимум по процессам.
+// Сумма сверяется на процессе 0 (и на всех процессах, если результат есть у всех)
+BenchmarkResult runMpiBenchmark(const string& group, const string& name, Context& ctx, const BenchmarkOptions& opt,
+                                long long expected, bool resultOnAllRanks, long long (*mode)(Context&), bool& ok) {
+    vector<double> samples;
+    for (int r = 0; r < opt.warmup + opt.repetitions; ++r) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+        long long sum = mode(ctx);
+        double elapsed = (MPI_Wtime() - start) * 1000;
+        double slowest = 0;
+        MPI_Reduce(&elapsed, &slowest, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+        if (r >= opt.warmup) samples.push_back(slowest);
+
+        if ((ctx.rank == 0 || resultOnAllRanks) && sum != expected) {
+            cerr << "ОШИБКА: " << name << " на процессе " << ctx.rank << ": " << sum << " вместо " << expected << endl;
+            ok = false;
+        }
+    }
+    return summarizeSamples(group, name, ctx.n, ctx.n * sizeof(int), samples);
+}
+
+bool parseArgs(int argc, char** argv, Config& config) {
+    bool parsed = parseBenchmarkArgs(argc, argv, config, [&](const string& arg, const string& value) {
+        if (arg == "--n") config.n = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--threads") config.threads = atoi(value.c_str());
+        else if (arg == "--chunks") config.chunks = atoi(value.c_str());
+        else if (arg == "--only") config.only = value;
+        else return FlagStatus::Unknown;
+        return FlagStatus::Ok;
+    });
+    if (!parsed) return false;
+    if (config.n == 0 || config.threads < 1 || config.chunks < 1 || config.options.repetitions <= 0
+        || config.options.warmup < 0) {
+        cerr << "Размер, потоки, части и повторы должны быть положительными" << endl;
+        return false;
+    }
+    if (config.n > static_cast<size_t>(INT_MAX)) {
+        cerr << "Размер не больше " << INT_MAX << " (счётчики и смещения MPI_Scatterv — int)" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {                   // Основная функция
+    int provided = 0;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);  // MPI вызывает только главный поток процесса
+
+    Context ctx;
+    MPI_Comm_rank(MPI_COMM_WORLD, &ctx.rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &ctx.size);
+
+    Config config;
+    bool parsed = parseArgs(argc, argv, config);    // Все процессы разбирают одни и те же аргументы
+    if (!parsed) {
+        MPI_Finalize();
+        return 1;
+    }
+    omp_set_num_threads(config.threads);
+
+    ctx.n = config.n;
+    ctx.chunks = config.chunks;
+    ctx.part = makePartition(ctx.n, ctx.size);
+    ctx.local.resize(ctx.part.counts[ctx.rank]);
+    for (int c = 0; c < ctx.chunks; ++c) {          // Раунд c: c-я часть куска каждого процесса
+        Partition r;
+        for (int p = 0; p < ctx.size; ++p) {
+            Partition pieces = makePartition(ctx.part.counts[p], ctx.chunks);
+            r.counts.push_back(pieces.counts[c]);
+            r.displs.push_back(ctx.part.displs[p] + pieces.displs[c]);
+        }
+        ctx.rounds.push_back(r);
+    }
+    int largestPiece = ctx.part.counts[0] / ctx.chunks + 1;
+    ctx.stage[0].resize(largestPiece);
+    ctx.stage[1].resize(largestPiece);
+
+    long long expected = 0;
+    if (ctx.rank == 0) {                            // Массив процесса 0 готовится до замеров, как в блокноте
+        ctx.full = generateArray(ctx.n, Distribution::Uniform, 0, VALUE_MAX);
+        for (int x : ctx.full) expected += x;
+
+        uint32_t wrapped = 0;                       // 32-битная сумма с переносом, как int в блокноте
+        for (int x : ctx.full) wrapped += static_cast<uint32_t>(x);
+        int32_t sum32 = static_cast<int32_t>(wrapped);
+        cout << "n = " << ctx.n << ", процессов MPI: " << ctx.size << ", потоков OpenMP в процессе: " << config.threads
+             << ", частей pipelined: " << ctx.chunks << ", повторов: " << config.options.repetitions
+             << " (прогрев " << config.options.warmup << ")" << endl;
+        cout << "Сумма (64 бита): " << expected << ", сумма в int: " << sum32
+             << (sum32 == expected ? " (совпадает)" : " (переполнение)") << endl;
+        cout << "MPI_Scatter по N / size элементов (как в блокноте) потерял бы " << ctx.n % ctx.size
+             << " элементов" << endl << endl;
+    }
+    MPI_Bcast(&expected, 1, MPI_LONG_LONG, 0, MPI_COMM_WORLD);
+
+    struct Mode {
+        const char* name;
+        long long (*run)(Context&);
+        bool resultOnAllRanks;
+    };
+    const Mode modes[] = {
+        {"root only", rootOnly, false},
+        {"scatterv + reduce", scattervReduce, false},
+        {"scatterv + allreduce", scattervAllreduce, true},
+        {"local gen + reduce", localGenerationReduce, false},
+        {"pipelined iscatterv", pipelined, false},
+    };
+
+    string group = "mpi np=" + to_string(ctx.size) + " n=" + to_string(ctx.n);   // Потоки процесса — в столбце thr
+    vector<BenchmarkResult> results;
+    bool ok = true;
+    for (const Mode& mode : modes) {                // Фильтр одинаков на всех процессах — коллективные вызовы совпадают
+        if (!config.only.empty() && string(mode.name).find(config.only) == string::npos) continue;
+        BenchmarkResult result = runMpiBenchmark(group, mode.name, ctx, config.options, expected,
+                                                 mode.resultOnAllRanks, mode.run, ok);
+        addResult(results, result);
+    }
+
+    int localOk = ok ? 1 : 0, allOk = 0;
+    MPI_Allreduce(&localOk, &allOk, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+    if (ctx.rank == 0) {
+        printBenchmarkTable(results, cout);
+        allOk = writeResultFiles(results, config.csvPath, config.jsonPath) && allOk;
+    }
+
+    MPI_Finalize();                                 // Завершаем MPI
+    return allOk ? 0 : 1;                           // Ненулевой код, если какая-то сумма неверна
+}
@@ -0,0 +1,200 @@
+// Benchmark: распределённая сортировка выборкой на MPI (Common/mpi_sort.h)
+// Массив из n элементов разложен по процессам с самого начала: каждый процесс генерирует свой кусок
+// (generateArraySlice), поэтому размер ограничен суммарной памятью процессов, а не памятью одного процесса.
+//   - mpiSampleSort — локальная сортировка, регулярная выборка разделителей, MPI_Alltoallv, k-путевое слияние;
+//   - эталон (--baseline 1) — std::sort всего массива на процессе 0 (нужна память под весь массив);
+//   - время запуска — от общего MPI_Barrier до конца сортировки на самом медленном процессе;
+//   - проверка: глобальный порядок (mpiIsSorted), количество элементов и контрольная сумма мультимножества
+//     до и после сортировки;
+//   - печатаются этапы (медиана по повторам максимума по процессам) и баланс кусков после обмена.
+//
+// Компиляция: mpicxx -std=c++17 -O3 -march=native -fopenmp mpi_sample_sort.cpp -o mpi_sample_sort
+// Запуск:     mpirun -np 4 ./mpi_sample_sort [--n 10000000] [--dist uniform|sorted|reverse|nearly-sorted|few-unique]
+//                                            [--threads 1] [--reps 5] [--warmup 1] [--baseline 1]
+//                                            [--csv results.csv] [--json results.json]
+//             (в Colab: mpirun --allow-run-as-root --oversubscribe -np 4 ./mpi_sample_sort)
+
+#include <iostream>      // Для работы с вводом/выводом (cout, cerr, endl)
+#include <iomanip>       // Для setprecision
+#include <string>        // Для аргументов командной строки
+#include <vector>        // Для массивов
+#include <algorithm>     // Для sort
+#include <cstdint>       // Для uint64_t
+#include <cstdlib>       // Для strtoull / atoi
+#include <mpi.h>         // MPI библиотека для распределённых вычислений
+#include <omp.h>         // Для OpenMP
+#include "../Common/benchmark.h"       // Статистика замеров, таблица, CSV / JSON
+#include "../Common/data_generator.h"  // Генерация кусков массива
+#include "../Common/reduction.h"       // Для threadRange (кусок процесса)
+#include "../Common/mpi_sort.h"        // Распределённая сортировка выборкой
+
+using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
+
+// Параметры запуска (--reps, --warmup, --csv, --json — в BenchmarkArgs)
+struct Config : BenchmarkArgs {
+    size_t n = 10000000;                          // Размер всего массива
+    Distribution dist = Distribution::Uniform;    // Распределение входных данных
+    int threads = 1;                              // Потоков OpenMP в каждом процессе
+    bool baseline = true;                         // Замерять std::sort всего массива на процессе 0
+};
+
+// Контрольная сумма мультимножества: количество и сумма хешей значений (не зависит от порядка элементов)
+struct Checksum {
+    unsigned long long count = 0;
+    unsigned long long hash = 0;
+};
+
+Checksum globalChecksum(const vector<int>& local) {
+    Checksum c;
+    c.count = local.size();
+    for (int x : local) c.hash += splitMix64(static_cast<uint64_t>(static_cast<unsigned>(x)));
+    Checksum total;
+    MPI_Allreduce(&c.count, &total.count, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&c.hash, &total.hash, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+    return total;
+}
+
+// Медиана значений (та же статистика, что у замеров)
+double median(const vector<double>& v) {
+    return summarizeSamples("", "", 0, 0, v).medianMs;
+}
+
+// Максимум по процессам (результат на процессе 0)
+double maxOverRanks(double value) {
+    double result = 0;
+    MPI_Reduce(&value, &result, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+    return result;
+}
+
+bool parseArgs(int argc, char** argv, Config& config) {
+    bool parsed = parseBenchmarkArgs(argc, argv, config, [&](const string& arg, const string& value) {
+        if (arg == "--n") config.n = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--dist") {
+            if (!parseDistribution(value, config.dist)) {
+                cerr << "Неизвестное распределение: " << value << endl;
+                return FlagStatus::Invalid;
+            }
+        }
+        else if (arg == "--threads") config.threads = atoi(value.c_str());
+        else if (arg == "--baseline") config.baseline = atoi(value.c_str()) != 0;
+        else return FlagStatus::Unknown;
+        return FlagStatus::Ok;
+    });
+    if (!parsed) return false;
+    if (config.n == 0 || config.threads < 1 || config.options.repetitions <= 0 || config.options.warmup < 0) {
+        cerr << "Размер, потоки и повторы должны быть положительными" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {                   // Основная функция
+    int provided = 0;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);  // MPI вызывает только главный поток процесса
+    int rank = 0, size = 1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    Config config;
+    config.options.repetitions = 5;
+    config.options.warmup = 1;
+    streambuf* errors = cerr.rdbuf();               // Все процессы разбирают одни и те же аргументы,
+    if (rank != 0) cerr.rdbuf(nullptr);             // а ошибки печатает только процесс 0 (не np раз)
+    bool parsed = parseArgs(argc, argv, config);
+    cerr.rdbuf(errors);                             // Вернуть поток ошибок (и сбросить его состояние)
+    if (!parsed) {
+        MPI_Finalize();
+        return 1;
+    }
+    omp_set_num_threads(config.threads);
+
+    size_t n = config.n;
+    size_t first = 0, end = 0;
+    threadRange(n, rank, size, first, end);         // Первые n % size процессов получают на один элемент больше
+    size_t count = end - first;
+    vector<int> local;
+    auto generateLocal = [&] {                      // Свой кусок того же массива при любом числе процессов
+        local.resize(count);
+        generateArraySlice(local.data(), first, count, n, config.dist, 0, 1 << 30);
+    };
+
+    if (rank == 0) {
+        cout << "n = " << n << " (" << distributionName(config.dist) << "), процессов MPI: " << size
+             << ", потоков OpenMP в процессе: " << config.threads << ", повторов: " << config.options.repetitions
+             << " (прогрев " << config.options.warmup << ")" << endl << endl;
+    }
+
+    const BenchmarkOptions& opt = config.options;
+    string group = "mpi sort np=" + to_string(size) + " n=" + to_string(n);
+    vector<BenchmarkResult> results;
+    bool ok = true;
+
+    // Эталон: процесс 0 сортирует весь массив, остальные ждут на барьере
+    if (config.baseline) {
+        vector<int> full;
+        vector<double> samples;
+        for (int r = 0; r < opt.warmup + opt.repetitions; ++r) {
+            if (rank == 0) full = generateArray(n, config.dist, 0, 1 << 30);
+            MPI_Barrier(MPI_COMM_WORLD);
+            double start = MPI_Wtime();
+            if (rank == 0) sort(full.begin(), full.end());
+            double slowest = maxOverRanks((MPI_Wtime() - start) * 1000);
+            if (r >= opt.warmup) samples.push_back(slowest);
+        }
+        if (rank == 0) addResult(results, summarizeSamples(group, "rank 0 std::sort", n, n * sizeof(int), samples));
+    }
+
+    // Распределённая сортировка
+    vector<double> samples, localSortMs, splittersMs, exchangeMs, mergeMs;
+    double maxReceived = 0;
+    for (int r = 0; r < opt.warmup + opt.repetitions; ++r) {
+        generateLocal();
+        Checksum before = globalChecksum(local);
+        MpiSortStats stats;
+        MPI_Barrier(MPI_COMM_WORLD);
+        double start = MPI_Wtime();
+        mpiSampleSort(local, MPI_COMM_WORLD, &stats);
+        double slowest = maxOverRanks((MPI_Wtime() - start) * 1000);
+
+        double phases[4] = {stats.localSortMs, stats.splittersMs, stats.exchangeMs, stats.mergeMs};
+        double slowestPhases[4] = {0, 0, 0, 0};
+        MPI_Reduce(phases, slowestPhases, 4, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+        double received = maxOverRanks(static_cast<double>(stats.received));
+        if (r >= opt.warmup) {
+            samples.push_back(slowest);
+            localSortMs.push_back(slowestPhases[0]);
+            splittersMs.push_back(slowestPhases[1]);
+            exchangeMs.push_back(slowestPhases[2]);
+            mergeMs.push_back(slowestPhases[3]);
+            maxReceived = received;
+        }
+
+        Checksum after = globalChecksum(local);
+        bool sorted = mpiIsSorted(local, MPI_COMM_WORLD);
+        if (!sorted || after.count != before.count || after.hash != before.hash) {
+            if (rank == 0) {
+                cerr << "ОШИБКА: mpiSampleSort: " << (sorted ? "" : "нарушен порядок; ")
+                     << "элементов " << after.count << " вместо " << before.count
+                     << (after.hash != before.hash ? ", элементы изменились" : "") << endl;
+            }
+            ok = false;
+        }
+    }
+
+    if (rank == 0) {
+        addResult(results, summarizeSamples(group, "mpiSampleSort", n, n * sizeof(int), samples));
+        printBenchmarkTable(results, cout);
+        cout << fixed << setprecision(3);
+        cout << endl << "Этапы (медиана максимума по процессам, ms): локальная сортировка " << median(localSortMs)
+             << ", разделители " << median(splittersMs) << ", обмен " << median(exchangeMs)
+             << ", слияние " << median(mergeMs) << endl;
+        cout << setprecision(2) << "Баланс: наибольший кусок после обмена " << static_cast<size_t>(maxReceived)
+             << " элементов, " << maxReceived * size / n << " от среднего" << endl;
+        cout.unsetf(ios::fixed);
+
+        ok = writeResultFiles(results, config.csvPath, config.jsonPath) && ok;
+    }
+
+    MPI_Finalize();                                 // Завершаем MPI
+    return ok ? 0 : 1;                              // Ненулевой код, если порядок или элементы нарушены
+}
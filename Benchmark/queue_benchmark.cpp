@@ -0,0 +1,238 @@
+// Benchmark: lock-free очередь и стек (Common/lockfree_queue.h, Common/lockfree_stack.h) против версий с mutex
+// Очередь и стек из Practice5 на GPU не были потокобезопасными; здесь их CPU-замена проверяется под нагрузкой:
+//   - producers потоков добавляют по своей части из items элементов, consumers потоков извлекают, пока всё не извлечено;
+//   - замер общим харнессом (Common/benchmark.h): прогрев, повторы, минимум, медиана, p95; n — число операций
+//     push + pop (2 * items), поэтому Melem/s в таблице — миллионов операций в секунду; первая строка группы — mutex;
+//   - задержка — время от push до pop для каждого 64-го элемента последнего запуска (p50 и p99, мкс), отдельной таблицей;
+//   - сумма и количество извлечённых элементов сверяются с добавленными (ничего не потеряно и не повторено).
+// Число производителей и потребителей: 1/1, 2/2, 4/4, ... до --max-threads потоков всего.
+//
+// Компиляция: g++ -std=c++17 -O3 -march=native -fopenmp queue_benchmark.cpp -o queue_benchmark
+// Запуск:     ./queue_benchmark [--items 1000000] [--capacity 1024] [--max-threads 64] [--reps 10] [--warmup 2]
+//                               [--csv results.csv] [--json results.json]
+
+#include <iostream>      // Для работы с вводом/выводом (cout, cerr, endl)
+#include <iomanip>       // Для setw / setprecision
+#include <string>        // Для аргументов командной строки
+#include <vector>        // Для массивов
+#include <deque>         // Для очереди с mutex
+#include <mutex>         // Для версий с mutex
+#include <memory>        // Для unique_ptr (новая структура перед каждым запуском)
+#include <atomic>        // Для счётчика завершённых производителей
+#include <thread>        // Для yield
+#include <chrono>        // Для меток времени
+#include <algorithm>     // Для sort
+#include <cstdint>       // Для uint64_t / int64_t
+#include <cstdlib>       // Для strtoull / atoi
+#include <omp.h>         // Для OpenMP
+#include "../Common/benchmark.h"       // Замер с прогревом, повторами и статистикой; percentile
+#include "../Common/reduction.h"       // Для threadRange / CACHE_LINE_SIZE
+#include "../Common/lockfree_queue.h"  // Очередь Вьюкова
+#include "../Common/lockfree_stack.h"  // Стек Трайбера
+
+using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
+
+const uint64_t LATENCY_SAMPLE_MASK = 63;          // Задержка замеряется для каждого 64-го элемента
+
+// Параметры запуска (--reps, --warmup, --csv, --json — в BenchmarkArgs)
+struct Config : BenchmarkArgs {
+    size_t items = 1000000;                       // Элементов за один запуск
+    size_t capacity = 1024;                       // Ёмкость очереди / стека
+    int maxThreads = 64;                          // Наибольшее число потоков (производители + потребители)
+};
+
+// Элемент: значение и время добавления
+struct Item {
+    uint64_t value = 0;
+    int64_t pushedNs = 0;
+};
+
+inline int64_t nowNs() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// ВЕРСИИ С MUTEX (эталон)
+class MutexQueue {
+public:
+    explicit MutexQueue(size_t capacity) : capacity_(capacity) {}
+    bool tryPush(const Item& item) {
+        lock_guard<mutex> lock(mutex_);
+        if (items_.size() >= capacity_) return false;
+        items_.push_back(item);
+        return true;
+    }
+    bool tryPop(Item& item) {
+        lock_guard<mutex> lock(mutex_);
+        if (items_.empty()) return false;
+        item = items_.front();
+        items_.pop_front();
+        return true;
+    }
+private:
+    mutex mutex_;
+    deque<Item> items_;
+    size_t capacity_;
+};
+
+class MutexStack {
+public:
+    explicit MutexStack(size_t capacity) : capacity_(capacity) { items_.reserve(capacity); }
+    bool tryPush(const Item& item) {
+        lock_guard<mutex> lock(mutex_);
+        if (items_.size() >= capacity_) return false;
+        items_.push_back(item);
+        return true;
+    }
+    bool tryPop(Item& item) {
+        lock_guard<mutex> lock(mutex_);
+        if (items_.empty()) return false;
+        item = items_.back();
+        items_.pop_back();
+        return true;
+    }
+private:
+    mutex mutex_;
+    vector<Item> items_;
+    size_t capacity_;
+};
+
+// Итог одного потребителя, в своей кэш-линии
+struct alignas(CACHE_LINE_SIZE) ConsumerResult {
+    uint64_t sum = 0;
+    size_t count = 0;
+    vector<double> latencyUs;
+};
+
+// Задержки и проверка одной конфигурации (время — в BenchmarkResult)
+struct LatencyResult {
+    string group;
+    string structure;
+    double p50Us = 0;
+    double p99Us = 0;
+    bool ok = true;
+};
+
+// Один запуск: producers добавляют значения 1..items, consumers извлекают до конца работы производителей
+template <typename Container>
+void runPipeline(Container& container, int producers, int consumers, size_t items, vector<double>& latencies, bool& ok) {
+    vector<ConsumerResult> results(consumers);
+    atomic<int> finishedProducers(0);
+
+    #pragma omp parallel num_threads(producers + consumers)
+    {
+        int tid = omp_get_thread_num();
+        if (tid < producers) {                                          // Производитель
+            size_t begin, end;
+            threadRange(items, tid, producers, begin, end);
+            for (size_t i = begin; i < end; ++i) {
+                Item item;
+                item.value = i + 1;
+                item.pushedNs = nowNs();
+                while (!container.tryPush(item)) this_thread::yield();  // Полна — ждём потребителей
+            }
+            finishedProducers.fetch_add(1, memory_order_release);
+        } else {                                                        // Потребитель
+            ConsumerResult& r = results[tid - producers];
+            Item item;
+            while (true) {
+                if (container.tryPop(item)) {
+                    r.sum += item.value;
+                    r.count++;
+                    if ((item.value & LATENCY_SAMPLE_MASK) == 0) r.latencyUs.push_back((nowNs() - item.pushedNs) / 1000.0);
+                } else if (finishedProducers.load(memory_order_acquire) == producers) {
+                    if (!container.tryPop(item)) break;                 // Производители закончили и пусто — выход
+                    r.sum += item.value;
+                    r.count++;
+                } else {
+                    this_thread::yield();
+                }
+            }
+        }
+    }
+    uint64_t sum = 0;
+    size_t count = 0;
+    latencies.clear();
+    for (const ConsumerResult& r : results) {
+        sum += r.sum;
+        count += r.count;
+        latencies.insert(latencies.end(), r.latencyUs.begin(), r.latencyUs.end());
+    }
+    ok = count == items && sum == static_cast<uint64_t>(items) * (items + 1) / 2;
+}
+
+// Замер одной конфигурации: перед каждым запуском новая пустая структура (не замеряется);
+// задержки — последнего запуска, проверка — всех запусков, включая прогрев
+template <typename Container>
+LatencyResult measure(const string& group, const string& structure, const Config& config, int producers, int consumers,
+                      vector<BenchmarkResult>& results) {
+    LatencyResult latency;
+    latency.group = group;
+    latency.structure = structure;
+    unique_ptr<Container> container;
+    vector<double> latencies;
+    size_t operations = 2 * config.items;                              // push + pop каждого элемента
+    BenchmarkResult result = runBenchmark(group, structure, operations, operations * sizeof(Item), config.options,
+                                          [&] { container.reset(new Container(config.capacity)); },
+                                          [&] {
+                                              bool ok = true;
+                                              runPipeline(*container, producers, consumers, config.items, latencies, ok);
+                                              latency.ok = latency.ok && ok;
+                                          });
+    result.threads = producers + consumers;                            // Команда producers + consumers, а не OpenMP по умолчанию
+    addResult(results, result);
+    sort(latencies.begin(), latencies.end());
+    latency.p50Us = percentile(latencies, 50);
+    latency.p99Us = percentile(latencies, 99);
+    return latency;
+}
+
+bool parseArgs(int argc, char** argv, Config& config) {
+    bool parsed = parseBenchmarkArgs(argc, argv, config, [&](const string& arg, const string& value) {
+        if (arg == "--items") config.items = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--capacity") config.capacity = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--max-threads") config.maxThreads = atoi(value.c_str());
+        else return FlagStatus::Unknown;
+        return FlagStatus::Ok;
+    });
+    if (!parsed) return false;
+    if (config.items == 0 || config.capacity == 0 || config.maxThreads < 2 || config.options.repetitions <= 0
+        || config.options.warmup < 0) {
+        cerr << "Элементы, ёмкость и повторы должны быть положительными, потоков не меньше 2" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {                   // Основная функция
+    Config config;
+    if (!parseArgs(argc, argv, config)) return 1;
+    omp_set_dynamic(0);                             // Ровно producers + consumers потоков
+
+    cout << "Элементов: " << config.items << ", ёмкость: " << config.capacity << ", повторов: "
+         << config.options.repetitions << " (прогрев " << config.options.warmup << ")" << endl;
+
+    // Группа — структура и число потоков; первая строка (mutex) — эталон ускорения
+    vector<BenchmarkResult> results;
+    vector<LatencyResult> latencies;
+    for (int pairs = 1; 2 * pairs <= config.maxThreads; pairs *= 2) {
+        string threads = " p=" + to_string(pairs) + " c=" + to_string(pairs);
+        latencies.push_back(measure<MutexQueue>("queue" + threads, "mutex queue", config, pairs, pairs, results));
+        latencies.push_back(measure<BoundedMpmcQueue<Item>>("queue" + threads, "lock-free queue", config, pairs, pairs, results));
+        latencies.push_back(measure<MutexStack>("stack" + threads, "mutex stack", config, pairs, pairs, results));
+        latencies.push_back(measure<LockFreeStack<Item>>("stack" + threads, "lock-free stack", config, pairs, pairs, results));
+    }
+    printBenchmarkTable(results, cout);
+
+    bool ok = true;
+    cout << endl << "Задержка push -> pop (каждый 64-й элемент последнего запуска):" << endl;
+    cout << left << setw(28) << "group" << setw(18) << "structure" << right << setw(10) << "p50 us" << setw(10) << "p99 us" << endl;
+    for (const LatencyResult& r : latencies) {
+        cout << left << setw(28) << r.group << setw(18) << r.structure << right << fixed << setprecision(2)
+             << setw(10) << r.p50Us << setw(10) << r.p99Us << (r.ok ? "" : "  ОШИБКА: элементы потеряны") << endl;
+        cout.unsetf(ios::fixed);
+        ok = ok && r.ok;
+    }
+
+    ok = writeResultFiles(results, config.csvPath, config.jsonPath) && ok;
+    return ok ? 0 : 1;                              // Ненулевой код, если элементы потеряны или повторены
+}
@@ -0,0 +1,143 @@
+// Benchmark: гетерогенный планировщик (Common/scheduler.h) против статического разбиения
+// Задача из Assignment4_Task3 — сумма массива, части которой считают разные исполнители. Там массив делился
+// пополам (half = N / 2) и половина CPU считалась до запуска GPU. Здесь исполнители работают одновременно:
+//   - cpu-fast — группа потоков CPU;
+//   - cpu-slow — такая же группа, заторможенная в --slowdown раз (имитация более медленного устройства);
+//   - cuda — ускоритель, если программа собрана с HP_USE_CUDA и есть устройство.
+// Сравниваются: последовательная сумма, статическое разбиение 50/50 (как в блокноте), лучшее статическое
+// разбиение из перебора долей 10%..90% и динамическое разбиение с оценкой пропускной способности и кражами.
+//
+// Компиляция: g++ -std=c++17 -O3 -march=native -fopenmp scheduler_benchmark.cpp -o scheduler_benchmark
+// Запуск:     ./scheduler_benchmark [--n 50000000] [--slowdown 3] [--threads 1] [--reps 10] [--warmup 2]
+//                                   [--csv results.csv] [--json results.json]
+
+#include <iostream>      // Для работы с вводом/выводом (cout, cerr, endl)
+#include <iomanip>       // Для setw / setprecision
+#include <string>        // Для аргументов командной строки
+#include <vector>        // Для массивов
+#include <memory>        // Для unique_ptr
+#include <atomic>        // Для общей суммы кусков
+#include <cstdlib>       // Для strtoull / atoi / atof
+#include <omp.h>         // Для OpenMP
+#include "../Common/benchmark.h"       // Замер с прогревом, повторами и статистикой
+#include "../Common/data_generator.h"  // Параллельная генерация массивов
+#include "../Common/backend.h"         // Вычислительные бэкенды (ускоритель)
+#include "../Common/scheduler.h"       // Гетерогенный планировщик
+
+using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
+
+// Параметры запуска (--reps, --warmup, --csv, --json — в BenchmarkArgs)
+struct Config : BenchmarkArgs {
+    size_t n = 50000000;                          // Размер массива
+    double slowdown = 3.0;                        // Во сколько раз медленнее cpu-slow
+    int threads = 1;                              // Потоков в каждой группе CPU
+};
+
+bool parseArgs(int argc, char** argv, Config& config) {
+    bool parsed = parseBenchmarkArgs(argc, argv, config, [&](const string& arg, const string& value) {
+        if (arg == "--n") config.n = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--slowdown") config.slowdown = atof(value.c_str());
+        else if (arg == "--threads") config.threads = atoi(value.c_str());
+        else return FlagStatus::Unknown;
+        return FlagStatus::Ok;
+    });
+    if (!parsed) return false;
+    if (config.n == 0 || config.slowdown < 1 || config.threads < 1 || config.options.repetitions <= 0 || config.options.warmup < 0) {
+        cerr << "Размер, потоки и повторы должны быть положительными, --slowdown не меньше 1" << endl;
+        return false;
+    }
+    return true;
+}
+
+// Статистика исполнителей последнего запуска
+void printReport(const string& title, const ScheduleReport& report) {
+    cout << title << ": " << fixed << setprecision(3) << report.totalMs << " ms" << endl;
+    for (const ExecutorStats& s : report.executors) {
+        cout << "  " << left << setw(10) << s.name << right << " элементов " << setw(11) << s.elements
+             << ", кусков " << setw(4) << s.chunks << " (украдено " << s.stolen << "), занят " << setw(9) << s.busyMs
+             << " ms, " << setw(10) << s.throughput << " эл/ms" << endl;
+    }
+    cout.unsetf(ios::fixed);
+}
+
+int main(int argc, char** argv) {                   // Основная функция
+    Config config;
+    if (!parseArgs(argc, argv, config)) return 1;
+
+    vector<int> data = generateArray(config.n, Distribution::Uniform, 0, 99999);
+    long long expected = 0;
+    for (int x : data) expected += x;
+
+    HeteroScheduler scheduler;
+    scheduler.addExecutor(unique_ptr<Executor>(new CpuExecutor("cpu-fast", config.threads)));
+    scheduler.addExecutor(unique_ptr<Executor>(new CpuExecutor("cpu-slow", config.threads, vector<int>(), config.slowdown)));
+#ifdef HP_USE_CUDA
+    unique_ptr<ComputeBackend> cuda = createCudaBackend();
+    if (cuda) scheduler.addExecutor(unique_ptr<Executor>(new BackendExecutor(std::move(cuda))));
+#endif
+
+    // Сумма куска прибавляется к общей один раз на кусок
+    atomic<long long> total(0);
+    HeteroTask task;
+    task.cpu = [&](size_t begin, size_t end) {
+        long long local = 0;
+        #pragma omp simd reduction(+:local)
+        for (size_t i = begin; i < end; ++i) local += data[i];
+        total += local;
+    };
+    task.device = [&](ComputeBackend& backend, size_t begin, size_t end) {
+        total += backend.reduceSum(data.data() + begin, end - begin);
+    };
+
+    cout << "Исполнителей: " << scheduler.executorCount() << ", потоков в группе CPU: " << config.threads
+         << ", cpu-slow медленнее в " << config.slowdown << " раз, повторов: " << config.options.repetitions
+         << " (прогрев " << config.options.warmup << ")" << endl;
+
+    const BenchmarkOptions& opt = config.options;
+    size_t n = config.n;
+    size_t bytes = n * sizeof(int);
+    string g = "hybrid sum n=" + to_string(n);
+    vector<BenchmarkResult> results;
+    bool ok = true;
+    auto reset = [&] { total = 0; };
+    auto verify = [&](const string& name) {
+        if (total != expected) {
+            cerr << "ОШИБКА: " << name << " дал " << total << " вместо " << expected << endl;
+            ok = false;
+        }
+    };
+
+    addResult(results, runBenchmark(g, "sequential", n, bytes, opt, reset, [&] { task.cpu(0, n); }));
+    verify("sequential");
+
+    // Статические разбиения: доля первого исполнителя, остальное поровну между остальными
+    size_t executors = scheduler.executorCount();
+    auto shares = [&](double first) {
+        vector<double> s(executors, (1.0 - first) / (executors - 1));
+        s[0] = first;
+        return s;
+    };
+    BenchmarkResult half = runBenchmark(g, "static 50/50", n, bytes, opt, reset,
+                                        [&] { scheduler.runStatic(task, n, shares(executors == 2 ? 0.5 : 1.0 / executors)); });
+    verify("static 50/50");
+    BenchmarkResult best;
+    for (int percent = 10; percent <= 90; percent += 10) {
+        BenchmarkResult r = runBenchmark(g, "best static " + to_string(percent) + "%", n, bytes, opt, reset,
+                                         [&] { scheduler.runStatic(task, n, shares(percent / 100.0)); });
+        verify(r.name);
+        if (best.name.empty() || r.medianMs < best.medianMs) best = r;
+    }
+    addResult(results, half);
+    addResult(results, best);
+
+    ScheduleReport last;
+    addResult(results, runBenchmark(g, "dynamic", n, bytes, opt, reset, [&] { last = scheduler.run(task, n); }));
+    verify("dynamic");
+
+    printBenchmarkTable(results, cout);
+    cout << endl;
+    printReport("Последний динамический запуск", last);
+
+    ok = writeResultFiles(results, config.csvPath, config.jsonPath) && ok;
+    return ok ? 0 : 1;                              // Ненулевой код, если какая-то сумма неверна
+}
@@ -0,0 +1,153 @@
+// Benchmark: compareSorts из Practice3task4 на настоящих параллельных сортировках
+// В блокноте "GPU" быстрая и пирамидальная сортировки запускались <<<1,1>>> (один поток), а пирамидальная
+// к тому же не сортировала массив; результаты не проверялись. Здесь на тех же размерах (10 000, 100 000, 1 000 000)
+// сравниваются параллельные реализации на CPU, и результат каждой сверяется с std::sort:
+//   - sort: std::sort (эталон), parallelMergeSort, mergePathSort, poolQuickSort (параллельное разбиение по блокам),
+//     parallelHeapSort (куски пирамидальной сортировкой + k-путевое слияние);
+//   - heap: std::make_heap против parallelMakeHeap (проверка — std::is_heap и тот же набор элементов);
+//   - topk: std::partial_sort против parallelTopK и parallelPartialSort (k наименьших по возрастанию).
+//
+// Компиляция: g++ -std=c++17 -O3 -march=native -fopenmp sort_comparison.cpp -o sort_comparison
+// Запуск:     ./sort_comparison [--sizes 10000,100000,1000000] [--dist uniform] [--k 100] [--reps 10] [--warmup 2]
+//                               [--threads 8] [--csv results.csv] [--json results.json]
+
+#include <iostream>      // Для работы с вводом/выводом (cout, cerr, endl)
+#include <sstream>       // Для разбора списка размеров
+#include <string>        // Для аргументов командной строки
+#include <vector>        // Для массивов
+#include <algorithm>     // Для sort, make_heap, is_heap, partial_sort
+#include <cstdlib>       // Для strtoull / atoi
+#include <omp.h>         // Для OpenMP
+#include "../Common/benchmark.h"       // Замер с прогревом, повторами и статистикой
+#include "../Common/data_generator.h"  // Параллельная генерация массивов
+#include "../Common/parallel_sort.h"   // Сортировка слиянием на задачах
+#include "../Common/merge_path.h"      // Сортировка слиянием merge path
+#include "../Common/pool_algorithms.h" // Быстрая сортировка на пуле потоков
+#include "../Common/heap_sort.h"       // Куча, пирамидальная сортировка, top-k
+
+using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
+
+// Параметры запуска (--reps, --warmup, --csv, --json — в BenchmarkArgs)
+struct Config : BenchmarkArgs {
+    vector<size_t> sizes = {10000, 100000, 1000000};  // Размеры массивов, как в compareSorts блокнота
+    Distribution dist = Distribution::Uniform;    // Распределение входных данных
+    size_t k = 100;                               // Элементов в top-k
+};
+
+// Замер ядра над копией data; после замера work — результат последнего запуска
+template <typename Kernel>
+BenchmarkResult benchCopy(const string& group, const string& name, const BenchmarkOptions& opt,
+                          const vector<int>& data, vector<int>& work, Kernel kernel) {
+    return runBenchmark(group, name, data.size(), data.size() * sizeof(int), opt,
+                        [&] { work = data; },
+                        [&] { kernel(work); doNotOptimize(work.data()); });
+}
+
+// Сравнение сортировок на массиве size элементов; false, если какой-то результат неверен
+bool compareSorts(size_t size, const Config& config, vector<BenchmarkResult>& results) {
+    const BenchmarkOptions& opt = config.options;
+    vector<int> data = generateArray(size, config.dist, 1, 1000000);  // Диапазон чисел как в блокноте
+    vector<int> sorted = data;
+    sort(sorted.begin(), sorted.end());
+    vector<int> work;
+    bool ok = true;
+
+    auto check = [&](const string& name, bool correct) {
+        if (!correct) {
+            cerr << "ОШИБКА: " << name << " на " << size << " элементах: неверный результат" << endl;
+            ok = false;
+        }
+    };
+
+    // Полная сортировка
+    string g = string("sort ") + distributionName(config.dist) + " n=" + to_string(size);
+    auto sortRow = [&](const string& name, void (*sortFn)(vector<int>&)) {
+        addResult(results, benchCopy(g, name, opt, data, work, sortFn));
+        check(name, work == sorted);
+    };
+    sortRow("std::sort", [](vector<int>& a) { sort(a.begin(), a.end()); });
+    sortRow("parallelMergeSort", [](vector<int>& a) { parallelMergeSort(a); });
+    sortRow("mergePathSort", [](vector<int>& a) { mergePathSort(a); });
+    sortRow("poolQuickSort", [](vector<int>& a) { poolQuickSort(a); });
+    sortRow("parallelHeapSort", [](vector<int>& a) { parallelHeapSort(a); });
+
+    // Построение кучи: тот же набор элементов и свойство кучи
+    g = "heap n=" + to_string(size);
+    auto heapRow = [&](const string& name, void (*heapFn)(vector<int>&)) {
+        addResult(results, benchCopy(g, name, opt, data, work, heapFn));
+        bool isHeap = is_heap(work.begin(), work.end());
+        sort(work.begin(), work.end());
+        check(name, isHeap && work == sorted);
+    };
+    heapRow("std::make_heap", [](vector<int>& a) { make_heap(a.begin(), a.end()); });
+    heapRow("parallelMakeHeap", [](vector<int>& a) { parallelMakeHeap(a); });
+
+    // k наименьших по возрастанию
+    size_t k = min(config.k, size);
+    g = "topk k=" + to_string(k) + " n=" + to_string(size);
+    vector<int> best;
+    addResult(results, benchCopy(g, "std::partial_sort", opt, data, work,
+                                 [k](vector<int>& a) { partial_sort(a.begin(), a.begin() + k, a.end()); }));
+    check("std::partial_sort", equal(work.begin(), work.begin() + k, sorted.begin()));
+    addResult(results, runBenchmark(g, "parallelTopK", size, size * sizeof(int), opt,
+                                    [&] { best = parallelTopK(data, k); doNotOptimize(best.data()); }));
+    check("parallelTopK", best == vector<int>(sorted.begin(), sorted.begin() + k));
+    addResult(results, benchCopy(g, "parallelPartialSort", opt, data, work,
+                                 [k](vector<int>& a) { parallelPartialSort(a, k); }));
+    bool prefixOk = equal(work.begin(), work.begin() + k, sorted.begin());
+    sort(work.begin(), work.end());
+    check("parallelPartialSort", prefixOk && work == sorted);
+    return ok;
+}
+
+bool parseArgs(int argc, char** argv, Config& config) {
+    bool parsed = parseBenchmarkArgs(argc, argv, config, [&](const string& arg, const string& value) {
+        if (arg == "--sizes") {
+            config.sizes.clear();
+            stringstream list(value);
+            string item;
+            while (getline(list, item, ',')) config.sizes.push_back(strtoull(item.c_str(), nullptr, 10));
+        }
+        else if (arg == "--dist") {
+            if (!parseDistribution(value, config.dist)) {
+                cerr << "Неизвестное распределение: " << value << endl;
+                return FlagStatus::Invalid;
+            }
+        }
+        else if (arg == "--k") config.k = strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--threads") omp_set_num_threads(atoi(value.c_str()));
+        else return FlagStatus::Unknown;
+        return FlagStatus::Ok;
+    });
+    if (!parsed) return false;
+    for (size_t n : config.sizes) {
+        if (n == 0) {
+            cerr << "Размеры должны быть положительными" << endl;
+            return false;
+        }
+    }
+    if (config.sizes.empty() || config.k == 0 || config.options.repetitions <= 0 || config.options.warmup < 0) {
+        cerr << "Нужны размеры, k и повторы больше нуля" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {                   // Основная функция
+    Config config;
+    if (!parseArgs(argc, argv, config)) return 1;
+
+    cout << "Потоков OpenMP: " << omp_get_max_threads() << ", пул потоков: " << ThreadPool::global().size()
+         << ", повторов: " << config.options.repetitions << " (прогрев " << config.options.warmup << ")" << endl;
+
+    vector<BenchmarkResult> results;
+    bool ok = true;
+    for (size_t size : config.sizes) {
+        ok = compareSorts(size, config, results) && ok;
+    }
+    printBenchmarkTable(results, cout);
+    cout << (ok ? "Все результаты совпадают с std::sort" : "Есть неверные результаты") << endl;
+
+    ok = writeResultFiles(results, config.csvPath, config.jsonPath) && ok;
+    return ok ? 0 : 1;                              // Ненулевой код, если какой-то результат неверен
+}
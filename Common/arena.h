@@ -0,0 +1,277 @@
+// Общая библиотека: выровненная арена для временных буферов и буфер замеров с восстановлением входа
+// Сортировки и сканы выделяли временную память при каждом вызове (std::vector<T> tmp(n) в слиянии и radix sort,
+// гистограммы потоков, частичные суммы скана), а программы замеров копировали вход отдельным vector для каждого
+// алгоритма (vector<int> arrSeq = arr; mergeArr = data; ...). Каждый замер включал malloc / free, первое обращение
+// к новым страницам и копирование, а все копии жили до конца итерации. Здесь:
+//   - Arena — арена с выделением сдвигом указателя (bump allocator): блоки выровнены на ARENA_ALIGNMENT (кэш-линия),
+//     освобождение — откат к отметке (mark / rewind); после полного отката несколько блоков сливаются в один,
+//     поэтому повторные вызовы того же размера не выделяют память вовсе;
+//   - scratchArena() — своя арена у каждого потока (thread_local): потоки OpenMP живут между параллельными
+//     областями, поэтому их арены переиспользуются от вызова к вызову;
+//   - ScratchArray<T> — временный массив из арены потока на время области видимости (RAII над mark / rewind);
+//     элементы не инициализируются. Для нетривиальных T — обычный std::vector;
+//   - BenchmarkBuffer<T> — буфер «копирование при сбросе»: неизменный вход и рабочий массив, оба выровнены;
+//     reset() восстанавливает вход параллельным копированием, большие массивы — потоковыми записями мимо кэша
+//     (_mm_stream_si128), поэтому каждый алгоритм начинает с одинаково холодного кэша.
+// Арена потока держит память до конца потока (размер самого большого временного буфера); вернуть её ОС —
+// scratchArena().release(). ScratchArray освобождаются в обратном порядке создания (как переменные на стеке).
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <cstdint>       // Для uintptr_t
+#include <cstring>       // Для memcpy
+#include <vector>        // Для списка блоков и запасного варианта ScratchArray
+#include <new>           // Для operator new с align_val_t
+#include <memory>        // Для unique_ptr
+#include <stdexcept>     // Для invalid_argument
+#include <type_traits>   // Для is_trivial / is_trivially_copyable
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"   // Для threadRange и CACHE_LINE_SIZE
+#if defined(__SSE2__)
+#include <emmintrin.h>   // Для _mm_stream_si128 / _mm_sfence
+#endif
+
+const std::size_t ARENA_ALIGNMENT = CACHE_LINE_SIZE;     // Выравнивание блоков и выделений арены
+const std::size_t ARENA_MIN_BLOCK = 64 << 10;            // Наименьший блок арены (64 КБ)
+const std::size_t STREAM_COPY_CUTOFF = 1 << 20;          // С этого размера копирование параллельное и мимо кэша
+
+// Память bytes байт, выровненная на ARENA_ALIGNMENT; освобождать alignedFree
+inline void* alignedAllocate(std::size_t bytes) {
+    return ::operator new(bytes, std::align_val_t(ARENA_ALIGNMENT));
+}
+
+inline void alignedFree(void* p) {
+    ::operator delete(p, std::align_val_t(ARENA_ALIGNMENT));
+}
+
+// Арена: выделение сдвигом указателя, освобождение откатом к отметке; только один поток
+class Arena {
+public:
+    // Состояние арены: блок, смещение в нём и байт в предыдущих блоках
+    struct Mark {
+        std::size_t block = 0;
+        std::size_t offset = 0;
+        std::size_t base = 0;
+    };
+
+    Arena() = default;
+    ~Arena() { release(); }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // bytes байт, выровненных на alignment (степень двойки, не больше ARENA_ALIGNMENT)
+    void* allocate(std::size_t bytes, std::size_t alignment = ARENA_ALIGNMENT) {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0 || alignment > ARENA_ALIGNMENT) {
+            throw std::invalid_argument("Arena: выравнивание должно быть степенью двойки не больше ARENA_ALIGNMENT");
+        }
+        for (; current_ < blocks_.size(); ++current_) {
+            std::size_t offset = (offset_ + alignment - 1) & ~(alignment - 1);
+            if (offset <= blocks_[current_].bytes && bytes <= blocks_[current_].bytes - offset) {
+                offset_ = offset + bytes;
+                return take(blocks_[current_].data + offset);
+            }
+            if (current_ + 1 == blocks_.size()) break;             // Хвост блока пропускается до отката
+            base_ += blocks_[current_].bytes;
+            offset_ = 0;
+        }
+        std::size_t size = bytes > ARENA_MIN_BLOCK ? bytes : ARENA_MIN_BLOCK;
+        if (size < capacity_) size = capacity_;                    // Рост геометрический: блоков O(log размера)
+        size = (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+        Block block{static_cast<char*>(alignedAllocate(size)), size};
+        if (!blocks_.empty()) base_ += blocks_[current_].bytes;
+        blocks_.push_back(block);
+        capacity_ += size;
+        current_ = blocks_.size() - 1;
+        offset_ = bytes;
+        return take(block.data);
+    }
+
+    // Массив n элементов T (без инициализации)
+    template <typename T>
+    T* allocate(std::size_t n) {
+        static_assert(alignof(T) <= ARENA_ALIGNMENT, "Arena: выравнивание типа больше ARENA_ALIGNMENT");
+        return static_cast<T*>(allocate(n * sizeof(T), ARENA_ALIGNMENT));
+    }
+
+    Mark mark() const { return Mark{current_, offset_, base_}; }
+
+    // Откат к отметке: всё выделенное после неё свободно. Полный откат сливает блоки в один размера пика
+    void rewind(const Mark& mark) {
+        current_ = mark.block;
+        offset_ = mark.offset;
+        base_ = mark.base;
+        if (current_ == 0 && offset_ == 0 && blocks_.size() > 1) {
+            std::size_t size = (peak_ + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+            release();
+            Block block{static_cast<char*>(alignedAllocate(size)), size};
+            blocks_.push_back(block);
+            capacity_ = peak_ = size;
+        }
+    }
+
+    void reset() { rewind(Mark()); }
+
+    // Вернуть всю память
+    void release() {
+        for (const Block& block : blocks_) alignedFree(block.data);
+        blocks_.clear();
+        current_ = offset_ = base_ = capacity_ = peak_ = 0;
+    }
+
+    std::size_t capacity() const { return capacity_; }            // Байт во всех блоках
+    std::size_t used() const { return base_ + offset_; }          // Байт занято (с пропущенными хвостами блоков)
+    std::size_t peak() const { return peak_; }                    // Наибольшее used() с последнего слияния блоков
+    std::size_t blockCount() const { return blocks_.size(); }
+
+private:
+    struct Block {
+        char* data;
+        std::size_t bytes;
+    };
+
+    void* take(char* p) {
+        if (used() > peak_) peak_ = used();
+        return p;
+    }
+
+    std::vector<Block> blocks_;
+    std::size_t current_ = 0;          // Текущий блок
+    std::size_t offset_ = 0;           // Занято в текущем блоке
+    std::size_t base_ = 0;             // Байт в блоках до текущего
+    std::size_t capacity_ = 0;
+    std::size_t peak_ = 0;
+};
+
+// Арена временных буферов текущего потока
+inline Arena& scratchArena() {
+    thread_local Arena arena;
+    return arena;
+}
+
+// Временный массив n элементов T на время области видимости; только в том потоке, который его создал
+template <typename T>
+class ScratchArray {
+public:
+    explicit ScratchArray(std::size_t n, Arena& arena = scratchArena()) : n_(n) {
+        if constexpr (IN_ARENA) {
+            arena_ = &arena;
+            mark_ = arena.mark();
+            data_ = arena.allocate<T>(n);
+        } else {
+            fallback_.resize(n);
+            data_ = fallback_.data();
+        }
+    }
+
+    ~ScratchArray() {
+        if (arena_) arena_->rewind(mark_);
+    }
+
+    ScratchArray(const ScratchArray&) = delete;
+    ScratchArray& operator=(const ScratchArray&) = delete;
+
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+    std::size_t size() const { return n_; }
+    T& operator[](std::size_t i) { return data_[i]; }
+    const T& operator[](std::size_t i) const { return data_[i]; }
+    T* begin() { return data_; }
+    T* end() { return data_ + n_; }
+
+private:
+    static constexpr bool IN_ARENA = std::is_trivial<T>::value && alignof(T) <= ARENA_ALIGNMENT;
+
+    Arena* arena_ = nullptr;
+    Arena::Mark mark_;
+    T* data_ = nullptr;
+    std::size_t n_ = 0;
+    std::vector<T> fallback_;          // Нетривиальные T
+};
+
+// Копирование одного куска: потоковые записи SSE2 (мимо кэша) или memcpy
+inline void streamCopyRange(char* dst, const char* src, std::size_t bytes) {
+#if defined(__SSE2__)
+    std::size_t head = (16 - (reinterpret_cast<std::uintptr_t>(dst) & 15)) & 15;  // До выровненного на 16 адреса
+    if (head > bytes) head = bytes;
+    std::memcpy(dst, src, head);
+    std::size_t i = head;
+    for (; i + 64 <= bytes; i += 64) {                          // Кэш-линия за итерацию
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 32));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 16), b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 32), c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i + 48), d);
+    }
+    std::memcpy(dst + i, src + i, bytes - i);
+    _mm_sfence();                                               // Потоковые записи видны до конца копирования
+#else
+    std::memcpy(dst, src, bytes);
+#endif
+}
+
+// Копирование bytes байт: меньше STREAM_COPY_CUTOFF — memcpy, больше — куски по кэш-линиям потокам OpenMP
+inline void parallelStreamCopy(void* dst, const void* src, std::size_t bytes) {
+    char* d = static_cast<char*>(dst);
+    const char* s = static_cast<const char*>(src);
+    if (bytes == 0) return;
+    if (bytes < STREAM_COPY_CUTOFF) {
+        std::memcpy(d, s, bytes);
+        return;
+    }
+    std::size_t lines = bytes / ARENA_ALIGNMENT;
+    #pragma omp parallel
+    {
+        int tid = omp_get_thread_num();
+        int nthreads = omp_get_num_threads();
+        std::size_t begin, end;
+        threadRange(lines, tid, nthreads, begin, end);
+        begin *= ARENA_ALIGNMENT;
+        end = tid == nthreads - 1 ? bytes : end * ARENA_ALIGNMENT;   // Последний поток — с неполной строкой
+        streamCopyRange(d + begin, s + begin, end - begin);
+    }
+}
+
+// Буфер замеров: неизменный вход и рабочий массив; reset() перед каждым алгоритмом вместо новой копии
+template <typename T>
+class BenchmarkBuffer {
+    static_assert(std::is_trivially_copyable<T>::value, "BenchmarkBuffer: вход восстанавливается побайтно");
+
+    struct Free {
+        void operator()(T* p) const { alignedFree(p); }
+    };
+    using Storage = std::unique_ptr<T[], Free>;
+
+public:
+    BenchmarkBuffer(const T* input, std::size_t n)
+        : input_(static_cast<T*>(alignedAllocate(n * sizeof(T)))), work_(static_cast<T*>(alignedAllocate(n * sizeof(T)))),
+          n_(n) {
+        parallelStreamCopy(input_.get(), input, n * sizeof(T));   // Страницы выделяются потоками, которые потом копируют
+        reset();
+    }
+
+    explicit BenchmarkBuffer(const std::vector<T>& input) : BenchmarkBuffer(input.data(), input.size()) {}
+
+    // Рабочий массив снова равен входу
+    void reset() { parallelStreamCopy(work_.get(), input_.get(), n_ * sizeof(T)); }
+
+    T* data() { return work_.get(); }
+    const T* data() const { return work_.get(); }
+    const T* input() const { return input_.get(); }
+    std::size_t size() const { return n_; }
+    T& operator[](std::size_t i) { return work_[i]; }
+    const T& operator[](std::size_t i) const { return work_[i]; }
+    T* begin() { return data(); }
+    T* end() { return data() + n_; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + n_; }
+
+private:
+    Storage input_;
+    Storage work_;
+    std::size_t n_ = 0;
+};
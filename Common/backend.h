@@ -0,0 +1,54 @@
+// Общая библиотека: выбор вычислительного бэкенда по имени
+//   - "cpu"  — CpuBackend, есть всегда;
+//   - "cuda" — CudaBackend, только если программа собрана с -DHP_USE_CUDA и есть устройство CUDA;
+//   - "auto" — CUDA, если доступна, иначе CPU.
+// Имя по умолчанию берётся из переменной окружения HP_BACKEND (если не задана — "auto").
+//
+// Сборка без GPU:  g++ -std=c++17 -O3 -march=native -fopenmp program.cpp -o program
+// Сборка с CUDA:   nvcc -O3 -std=c++17 -DHP_USE_CUDA -c ../Common/cuda_backend.cu -o cuda_backend.o
+//                  g++ -std=c++17 -O3 -march=native -fopenmp -DHP_USE_CUDA program.cpp cuda_backend.o
+//                          -L/usr/local/cuda/lib64 -lcudart -o program
+
+#pragma once
+
+#include <cstdlib>       // Для getenv
+#include <memory>        // Для unique_ptr
+#include <string>        // Для имён бэкендов
+#include <vector>        // Для списка доступных бэкендов
+#include "compute_backend.h" // Интерфейс бэкенда
+#include "cpu_backend.h"     // CPU-бэкенд
+
+// Бэкенд по имени; nullptr — имя неизвестно или бэкенд недоступен в этой сборке
+inline std::unique_ptr<ComputeBackend> createBackend(const std::string& name) {
+    if (name == "cpu") return std::unique_ptr<ComputeBackend>(new CpuBackend());
+#ifdef HP_USE_CUDA
+    if (name == "cuda") return createCudaBackend();
+    if (name == "auto") {
+        std::unique_ptr<ComputeBackend> cuda = createCudaBackend();
+        if (cuda) return cuda;
+    }
+#endif
+    if (name == "auto") return std::unique_ptr<ComputeBackend>(new CpuBackend());
+    return nullptr;
+}
+
+// Имя бэкенда по умолчанию
+inline std::string defaultBackendName() {
+    const char* env = std::getenv("HP_BACKEND");
+    return env && *env ? std::string(env) : std::string("auto");
+}
+
+// Бэкенд по умолчанию (HP_BACKEND или "auto")
+inline std::unique_ptr<ComputeBackend> createDefaultBackend() {
+    return createBackend(defaultBackendName());
+}
+
+// Имена бэкендов, которые можно создать в этой сборке на этой машине
+inline std::vector<std::string> availableBackends() {
+    std::vector<std::string> names;
+    names.push_back("cpu");
+#ifdef HP_USE_CUDA
+    if (createCudaBackend()) names.push_back("cuda");
+#endif
+    return names;
+}
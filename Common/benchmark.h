@@ -0,0 +1,249 @@
+// Общая библиотека: измерение времени с прогревом, повторами и статистикой
+// Раньше каждая программа замеряла один запуск парой chrono::high_resolution_clock без прогрева,
+// а единицы были разные (ms в Assignment_1, секунды в Assignment_2 и Practice2). Здесь:
+//   - ядро запускается warmup раз без замера, затем repetitions раз с замером (steady_clock);
+//   - перед каждым запуском выполняется подготовка (например, копия несортированного массива) — она не замеряется;
+//   - отчёт: минимум, медиана, 95-й перцентиль и среднее в миллисекундах, пропускная способность
+//     в ГБ/с и элементах/с (по медиане), ускорение относительно последовательного эталона группы;
+//   - результаты печатаются таблицей и сохраняются в CSV или JSON;
+//   - общий разбор командной строки программ Benchmark (--flag value, общие --reps / --warmup / --csv / --json):
+//     программа разбирает только свои флаги.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <chrono>        // Для steady_clock
+#include <string>        // Для имён
+#include <vector>        // Для замеров и результатов
+#include <algorithm>     // Для sort
+#include <cmath>         // Для ceil
+#include <ostream>       // Для вывода отчётов
+#include <iostream>      // Для cout / cerr (ошибки разбора аргументов, имена файлов результатов)
+#include <fstream>       // Для записи CSV / JSON
+#include <cstdlib>       // Для atoi
+#include <iomanip>       // Для setw / setprecision
+#include <omp.h>         // Для omp_get_max_threads
+
+// Настройки замера
+struct BenchmarkOptions {
+    int warmup = 2;                    // Запусков без замера (прогрев кэшей, страниц памяти и потоков OpenMP)
+    int repetitions = 10;              // Запусков с замером
+};
+
+// Результат одного ядра
+struct BenchmarkResult {
+    std::string group;                 // Группа сравнения (одна задача, один размер)
+    std::string name;                  // Имя ядра
+    std::size_t n = 0;                 // Количество элементов
+    std::size_t bytes = 0;             // Объём входных данных в байтах
+    int threads = 1;                   // Потоков OpenMP
+    int repetitions = 0;               // Замеров
+    double minMs = 0;                  // Минимальное время
+    double medianMs = 0;               // Медиана
+    double p95Ms = 0;                  // 95-й перцентиль
+    double meanMs = 0;                 // Среднее
+    double gbPerSec = 0;               // bytes / медиана
+    double elementsPerSec = 0;         // n / медиана
+    double speedup = 1;                // Медиана эталона / медиана ядра
+};
+
+// Не даёт компилятору выбросить вычисление, результат которого не используется
+template <typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+// Перцентиль p (0..100) отсортированной выборки, метод ближайшего ранга
+inline double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0;
+    std::size_t rank = static_cast<std::size_t>(std::ceil(p / 100.0 * sorted.size()));
+    if (rank < 1) rank = 1;
+    if (rank > sorted.size()) rank = sorted.size();
+    return sorted[rank - 1];
+}
+
+// Статистика по временам запусков (ms), замеренным снаружи (например, максимум по процессам MPI)
+inline BenchmarkResult summarizeSamples(const std::string& group, const std::string& name, std::size_t n,
+                                        std::size_t bytes, std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+
+    BenchmarkResult result;
+    result.group = group;
+    result.name = name;
+    result.n = n;
+    result.bytes = bytes;
+    result.threads = omp_get_max_threads();
+    result.repetitions = static_cast<int>(samples.size());
+    if (samples.empty()) return result;
+
+    double total = 0;
+    for (double s : samples) total += s;
+    result.minMs = samples.front();
+    result.medianMs = samples.size() % 2 ? samples[samples.size() / 2]
+                                         : (samples[samples.size() / 2 - 1] + samples[samples.size() / 2]) / 2;
+    result.p95Ms = percentile(samples, 95);
+    result.meanMs = total / samples.size();
+    if (result.medianMs > 0) {
+        result.gbPerSec = bytes / (result.medianMs * 1e6);             // байт/ms -> ГБ/с
+        result.elementsPerSec = n / (result.medianMs * 1e-3);
+    }
+    return result;
+}
+
+// Замер ядра: setup() перед каждым запуском (не замеряется), затем kernel()
+template <typename Setup, typename Kernel>
+BenchmarkResult runBenchmark(const std::string& group, const std::string& name, std::size_t n, std::size_t bytes,
+                             const BenchmarkOptions& options, Setup setup, Kernel kernel) {
+    for (int w = 0; w < options.warmup; ++w) {
+        setup();
+        kernel();
+    }
+
+    std::vector<double> samples;                                       // Времена запусков, ms
+    samples.reserve(options.repetitions);
+    for (int r = 0; r < options.repetitions; ++r) {
+        setup();
+        auto start = std::chrono::steady_clock::now();
+        kernel();
+        auto end = std::chrono::steady_clock::now();
+        samples.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    return summarizeSamples(group, name, n, bytes, samples);
+}
+
+// Замер без подготовки (ядро не меняет входные данные)
+template <typename Kernel>
+BenchmarkResult runBenchmark(const std::string& group, const std::string& name, std::size_t n, std::size_t bytes,
+                             const BenchmarkOptions& options, Kernel kernel) {
+    return runBenchmark(group, name, n, bytes, options, [] {}, kernel);
+}
+
+// Добавление результата: первый результат каждой группы — последовательный эталон для ускорения
+inline void addResult(std::vector<BenchmarkResult>& results, BenchmarkResult result) {
+    for (const BenchmarkResult& r : results) {
+        if (r.group == result.group) {                                 // Эталон группы уже есть
+            if (result.medianMs > 0) result.speedup = r.medianMs / result.medianMs;
+            break;
+        }
+    }
+    results.push_back(result);
+}
+
+// Таблица для консоли
+inline void printBenchmarkTable(const std::vector<BenchmarkResult>& results, std::ostream& out) {
+    out << std::left << std::setw(28) << "group" << std::setw(26) << "name"
+        << std::right << std::setw(4) << "thr" << std::setw(11) << "min ms" << std::setw(11) << "median ms"
+        << std::setw(11) << "p95 ms" << std::setw(9) << "GB/s" << std::setw(11) << "Melem/s"
+        << std::setw(9) << "speedup" << "\n";
+    std::string lastGroup;
+    for (const BenchmarkResult& r : results) {
+        if (!lastGroup.empty() && r.group != lastGroup) out << "\n";  // Пустая строка между группами
+        lastGroup = r.group;
+        out << std::left << std::setw(28) << r.group << std::setw(26) << r.name
+            << std::right << std::setw(4) << r.threads << std::fixed << std::setprecision(3)
+            << std::setw(11) << r.minMs << std::setw(11) << r.medianMs << std::setw(11) << r.p95Ms
+            << std::setprecision(2) << std::setw(9) << r.gbPerSec << std::setw(11) << r.elementsPerSec / 1e6
+            << std::setw(8) << r.speedup << "x" << "\n";
+        out.unsetf(std::ios::fixed);
+    }
+}
+
+inline void writeBenchmarkCsv(const std::vector<BenchmarkResult>& results, std::ostream& out) {
+    out << "group,name,n,bytes,threads,repetitions,min_ms,median_ms,p95_ms,mean_ms,gb_per_s,elements_per_s,speedup\n";
+    out << std::setprecision(6);
+    for (const BenchmarkResult& r : results) {
+        out << r.group << "," << r.name << "," << r.n << "," << r.bytes << "," << r.threads << ","
+            << r.repetitions << "," << r.minMs << "," << r.medianMs << "," << r.p95Ms << "," << r.meanMs << ","
+            << r.gbPerSec << "," << r.elementsPerSec << "," << r.speedup << "\n";
+    }
+}
+
+inline void writeBenchmarkJson(const std::vector<BenchmarkResult>& results, std::ostream& out) {
+    out << "[\n" << std::setprecision(6);
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult& r = results[i];
+        out << "  {\"group\": \"" << r.group << "\", \"name\": \"" << r.name << "\", \"n\": " << r.n
+            << ", \"bytes\": " << r.bytes << ", \"threads\": " << r.threads << ", \"repetitions\": " << r.repetitions
+            << ", \"min_ms\": " << r.minMs << ", \"median_ms\": " << r.medianMs << ", \"p95_ms\": " << r.p95Ms
+            << ", \"mean_ms\": " << r.meanMs << ", \"gb_per_s\": " << r.gbPerSec
+            << ", \"elements_per_s\": " << r.elementsPerSec << ", \"speedup\": " << r.speedup << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+}
+
+// Один файл результатов: write(поток) пишет содержимое; пустой путь — файл не пишется.
+// false и сообщение в cerr, если файл не открылся или запись не удалась; иначе имя файла печатается в out
+template <typename Write>
+bool writeResultFile(const std::string& path, const char* format, Write write, std::ostream& out) {
+    if (path.empty()) return true;
+    std::ofstream file(path);
+    if (file) {
+        write(file);
+        file.close();                                                  // Сброс буфера: ошибка записи видна в состоянии
+    }
+    if (!file) {
+        std::cerr << "ОШИБКА: не удалось записать " << format << " в " << path << std::endl;
+        return false;
+    }
+    out << format << ": " << path << "\n";
+    return true;
+}
+
+// CSV и JSON по путям из командной строки (пустой путь — файл не пишется); false — какой-то файл не записан
+inline bool writeResultFiles(const std::vector<BenchmarkResult>& results, const std::string& csvPath,
+                             const std::string& jsonPath, std::ostream& out = std::cout) {
+    bool csv = writeResultFile(csvPath, "CSV", [&](std::ostream& file) { writeBenchmarkCsv(results, file); }, out);
+    bool json = writeResultFile(jsonPath, "JSON", [&](std::ostream& file) { writeBenchmarkJson(results, file); }, out);
+    return csv && json;
+}
+
+// Общие флаги программ Benchmark: Config программы наследует их и объявляет только свои
+struct BenchmarkArgs {
+    BenchmarkOptions options;          // --warmup, --reps
+    std::string csvPath;               // --csv: файл CSV (пусто — не сохранять)
+    std::string jsonPath;              // --json: файл JSON (пусто — не сохранять)
+};
+
+// Итог разбора одного флага программой
+enum class FlagStatus {
+    Ok,
+    Unknown,                           // Флаг не этой программы
+    Invalid                            // Неверное значение (сообщение печатает программа)
+};
+
+// Разбор командной строки вида --flag value ...: каждому флагу нужно значение, parseFlag(flag, value) разбирает его;
+// false — ошибка (сообщение уже напечатано)
+template <typename ParseFlag>
+bool parseFlags(int argc, char** argv, ParseFlag parseFlag) {
+    for (int i = 1; i < argc; ++i) {
+        std::string flag = argv[i];
+        if (i + 1 >= argc) {
+            std::cerr << "Нет значения для " << flag << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+        FlagStatus status = parseFlag(flag, value);
+        if (status == FlagStatus::Unknown) std::cerr << "Неизвестный аргумент: " << flag << std::endl;
+        if (status != FlagStatus::Ok) return false;
+    }
+    return true;
+}
+
+// То же с общими флагами --reps, --warmup, --csv, --json; остальные передаются в parseFlag
+template <typename ParseFlag>
+bool parseBenchmarkArgs(int argc, char** argv, BenchmarkArgs& args, ParseFlag parseFlag) {
+    return parseFlags(argc, argv, [&](const std::string& flag, const std::string& value) {
+        if (flag == "--reps") args.options.repetitions = std::atoi(value.c_str());
+        else if (flag == "--warmup") args.options.warmup = std::atoi(value.c_str());
+        else if (flag == "--csv") args.csvPath = value;
+        else if (flag == "--json") args.jsonPath = value;
+        else return parseFlag(flag, value);
+        return FlagStatus::Ok;
+    });
+}
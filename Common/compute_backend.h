@@ -0,0 +1,44 @@
+// Общая библиотека: интерфейс вычислительного бэкенда (reduce / scan / map / sort / merge)
+// Ядра CUDA из блокнотов (reduction_shared в Practice4, prefixSumKernel в Practice7, multiply_shared и vector_add
+// в Assignment_3, mergeKernel в Assignment_2) существуют только как .cu-файлы, записанные из ячеек, и без GPU
+// не запускаются. Здесь — общий интерфейс этих примитивов:
+//   - CpuBackend (cpu_backend.h) — OpenMP + SIMD на ядрах Common, собирается всегда;
+//   - CudaBackend (cuda_backend.cu) — ядра блокнотов, собирается только с флагом HP_USE_CUDA;
+//   - createBackend (backend.h) выбирает бэкенд по имени, без GPU "auto" возвращает CPU.
+// Все указатели — память хоста; CUDA-бэкенд сам копирует данные на устройство и обратно.
+// Этот файл не подключает OpenMP и заголовки Common, чтобы его можно было компилировать nvcc.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <memory>        // Для unique_ptr
+
+// Примитивы, одинаковые для всех бэкендов
+class ComputeBackend {
+public:
+    virtual ~ComputeBackend() {}
+
+    // Имя бэкенда ("cpu", "cuda")
+    virtual const char* name() const = 0;
+
+    // Сумма n элементов в 64 бита (reduction_shared / reductionKernel)
+    virtual long long reduceSum(const int* data, std::size_t n) = 0;
+
+    // Префиксная сумма: включающая или исключающая (prefixSumKernel); in и out могут совпадать
+    virtual void scan(const int* in, int* out, std::size_t n, bool inclusive) = 0;
+
+    // data[i] *= k (multiply_shared)
+    virtual void mapScale(float* data, std::size_t n, float k) = 0;
+
+    // c[i] = a[i] + b[i] (vector_add)
+    virtual void mapAdd(const float* a, const float* b, float* c, std::size_t n) = 0;
+
+    // Сортировка по возрастанию на месте
+    virtual void sort(int* data, std::size_t n) = 0;
+
+    // Устойчивое слияние отсортированных a[0..na) и b[0..nb) в out[0..na + nb) (mergeKernel)
+    virtual void merge(const int* a, std::size_t na, const int* b, std::size_t nb, int* out) = 0;
+};
+
+// Определена в cuda_backend.cu (только при сборке с HP_USE_CUDA); nullptr, если устройства CUDA нет
+std::unique_ptr<ComputeBackend> createCudaBackend();
@@ -0,0 +1,58 @@
+// Общая библиотека: CPU-бэкенд интерфейса ComputeBackend на OpenMP + SIMD
+// Каждый примитив — уже оптимизированное ядро Common, поэтому программы с бэкендом на машине без GPU
+// получают те же реализации, что и остальной код:
+//   - reduceSum — parallelReduce (несколько аккумуляторов, частичные суммы в отдельных кэш-линиях);
+//   - scan — inclusiveScan / exclusiveScan из scan.h (плитки, AVX2-скан внутри регистра);
+//   - mapScale / mapAdd — omp parallel for simd, маленькие массивы без команды потоков;
+//   - sort — поразрядная сортировка radixSortParallel (ключи int, сравнения не нужны);
+//   - merge — parallelMergeRange на задачах OpenMP.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <omp.h>         // Для OpenMP
+#include "compute_backend.h" // Интерфейс бэкенда
+#include "reduction.h"       // Для parallelSum
+#include "scan.h"            // Для inclusiveScan / exclusiveScan
+#include "radix_sort.h"      // Для radixSortParallel
+#include "parallel_sort.h"   // Для parallelMergeRange
+
+const std::size_t MAP_SEQUENTIAL_CUTOFF = 1 << 15;     // Ниже этого размера map выполняет один поток
+
+class CpuBackend : public ComputeBackend {
+public:
+    const char* name() const override { return "cpu"; }
+
+    long long reduceSum(const int* data, std::size_t n) override {
+        return parallelSum(data, n);
+    }
+
+    void scan(const int* in, int* out, std::size_t n, bool inclusive) override {
+        if (inclusive) inclusiveScan(in, out, n);
+        else exclusiveScan(in, out, n);
+    }
+
+    void mapScale(float* data, std::size_t n, float k) override {
+        #pragma omp parallel for simd schedule(static) if (n >= MAP_SEQUENTIAL_CUTOFF)
+        for (std::size_t i = 0; i < n; ++i) {
+            data[i] *= k;
+        }
+    }
+
+    void mapAdd(const float* a, const float* b, float* c, std::size_t n) override {
+        #pragma omp parallel for simd schedule(static) if (n >= MAP_SEQUENTIAL_CUTOFF)
+        for (std::size_t i = 0; i < n; ++i) {
+            c[i] = a[i] + b[i];
+        }
+    }
+
+    void sort(int* data, std::size_t n) override {
+        radixSortParallel(data, n);
+    }
+
+    void merge(const int* a, std::size_t na, const int* b, std::size_t nb, int* out) override {
+        #pragma omp parallel if (na + nb >= MERGE_TASK_CUTOFF)
+        #pragma omp single nowait                    // Один поток порождает задачи, остальные их выполняют
+        parallelMergeRange(a, na, b, nb, out);
+    }
+};
@@ -0,0 +1,259 @@
+// Общая библиотека: CUDA-бэкенд интерфейса ComputeBackend (собирается только с -DHP_USE_CUDA)
+// Ядра перенесены из блокнотов и доведены до общего случая:
+//   - reduceSum — reduction_shared (Practice4): сумма блока деревом в shared memory, затем atomicAdd;
+//     поток сначала суммирует несколько элементов (grid-stride), сумма 64-битная (int переполняется);
+//   - scan — prefixSumKernel (Practice7): исключающий скан блока Blelloch (upsweep / downsweep),
+//     суммы блоков сканируются рекурсивно и прибавляются ядром addBlockSums — массив любого размера;
+//   - mapScale / mapAdd — multiply_shared и vector_add (Assignment_3); shared memory в поэлементной
+//     операции ничего не даёт (каждый элемент читается один раз), поэтому ядра читают global напрямую;
+//   - merge — слияние по merge path: каждый поток двоичным поиском находит свой отрезок в a и b
+//     и сливает MERGE_ITEMS элементов (в mergeKernel один поток сливал целый подмассив);
+//   - sort — thrust::sort (поразрядная сортировка на устройстве).
+// Данные приходят из памяти хоста: каждый вызов копирует их на устройство и обратно, как программы блокнотов.
+//
+// Компиляция: nvcc -O3 -std=c++17 -DHP_USE_CUDA -c cuda_backend.cu -o cuda_backend.o
+
+#ifdef HP_USE_CUDA
+
+#include <cuda_runtime.h>        // Для cudaMalloc / cudaMemcpy
+#include <thrust/sort.h>         // Для thrust::sort
+#include <thrust/execution_policy.h> // Для thrust::device
+#include <stdexcept>             // Для runtime_error
+#include <string>                // Для текста ошибки
+#include "compute_backend.h"     // Интерфейс бэкенда
+
+const int CUDA_BLOCK_SIZE = 256;         // Потоков в блоке (как в reduction_shared)
+const int CUDA_SCAN_BLOCK = 1024;        // Элементов в блоке скана (степень двойки для Blelloch)
+const int CUDA_MAX_BLOCKS = 1024;        // Блоков в ядрах с grid-stride
+const int CUDA_MERGE_ITEMS = 16;         // Элементов результата на поток слияния
+
+// Ошибка CUDA — исключение с текстом вызова
+inline void cudaCheck(cudaError_t err, const char* call) {
+    if (err != cudaSuccess) throw std::runtime_error(std::string(call) + ": " + cudaGetErrorString(err));
+}
+#define CUDA_CHECK(call) cudaCheck((call), #call)
+
+// Буфер на устройстве, освобождается в деструкторе
+template <typename T>
+struct DeviceBuffer {
+    T* ptr = nullptr;
+
+    explicit DeviceBuffer(std::size_t n) {
+        if (n) CUDA_CHECK(cudaMalloc(&ptr, n * sizeof(T)));
+    }
+    ~DeviceBuffer() { cudaFree(ptr); }
+    DeviceBuffer(const DeviceBuffer&) = delete;
+    DeviceBuffer& operator=(const DeviceBuffer&) = delete;
+
+    void upload(const T* host, std::size_t n) {
+        if (n) CUDA_CHECK(cudaMemcpy(ptr, host, n * sizeof(T), cudaMemcpyHostToDevice));
+    }
+    void download(T* host, std::size_t n) const {
+        if (n) CUDA_CHECK(cudaMemcpy(host, ptr, n * sizeof(T), cudaMemcpyDeviceToHost));
+    }
+};
+
+// Блоков для n элементов при blockSize потоках, не больше limit (остальное — grid-stride)
+inline unsigned int gridSize(std::size_t n, int blockSize, int limit) {
+    std::size_t blocks = (n + blockSize - 1) / blockSize;
+    return static_cast<unsigned int>(blocks < static_cast<std::size_t>(limit) ? (blocks ? blocks : 1) : limit);
+}
+
+// Сумма: поток суммирует свои элементы, блок — деревом в shared memory, первый поток — atomicAdd
+__global__ void reductionKernel(const int* arr, unsigned long long* result, std::size_t n) {
+    __shared__ long long shared[CUDA_BLOCK_SIZE];               // Разделяемая память блока
+
+    int tid = threadIdx.x;
+    long long local = 0;
+    for (std::size_t i = blockIdx.x * (std::size_t)blockDim.x + tid; i < n; i += (std::size_t)gridDim.x * blockDim.x) {
+        local += arr[i];
+    }
+    shared[tid] = local;
+    __syncthreads();
+
+    for (int stride = blockDim.x / 2; stride > 0; stride >>= 1) {
+        if (tid < stride) shared[tid] += shared[tid + stride];
+        __syncthreads();
+    }
+
+    if (tid == 0) atomicAdd(result, static_cast<unsigned long long>(shared[0])); // Дополнительный код: знак сохраняется
+}
+
+// Исключающий скан блока (Blelloch); сумма блока записывается в blockSums[blockIdx.x]
+__global__ void prefixSumKernel(const int* input, int* output, int* blockSums, std::size_t n) {
+    extern __shared__ int temp[];
+    int tid = threadIdx.x;
+    std::size_t i = blockIdx.x * (std::size_t)blockDim.x + tid;
+
+    temp[tid] = i < n ? input[i] : 0;
+    __syncthreads();
+
+    for (int offset = 1; offset < blockDim.x; offset *= 2) {    // Шаг вверх (upsweep)
+        int index = (tid + 1) * offset * 2 - 1;
+        if (index < blockDim.x) temp[index] += temp[index - offset];
+        __syncthreads();
+    }
+
+    if (tid == 0) {
+        blockSums[blockIdx.x] = temp[blockDim.x - 1];           // Сумма блока — до обнуления
+        temp[blockDim.x - 1] = 0;
+    }
+    __syncthreads();
+
+    for (int offset = blockDim.x / 2; offset > 0; offset /= 2) { // Шаг вниз (downsweep)
+        int index = (tid + 1) * offset * 2 - 1;
+        if (index < blockDim.x) {
+            int t = temp[index - offset];
+            temp[index - offset] = temp[index];
+            temp[index] += t;
+        }
+        __syncthreads();
+    }
+
+    if (i < n) output[i] = temp[tid];
+}
+
+// Прибавление отсканированных сумм предыдущих блоков
+__global__ void addBlockSums(int* output, const int* scannedSums, std::size_t n) {
+    std::size_t i = blockIdx.x * (std::size_t)blockDim.x + threadIdx.x;
+    if (i < n) output[i] += scannedSums[blockIdx.x];
+}
+
+// Исключающий скан -> включающий: out[i] += in[i]
+__global__ void exclusiveToInclusive(const int* input, int* output, std::size_t n) {
+    for (std::size_t i = blockIdx.x * (std::size_t)blockDim.x + threadIdx.x; i < n; i += (std::size_t)gridDim.x * blockDim.x) {
+        output[i] += input[i];
+    }
+}
+
+__global__ void scaleKernel(float* arr, float k, std::size_t n) {
+    for (std::size_t i = blockIdx.x * (std::size_t)blockDim.x + threadIdx.x; i < n; i += (std::size_t)gridDim.x * blockDim.x) {
+        arr[i] *= k;
+    }
+}
+
+__global__ void vectorAddKernel(const float* a, const float* b, float* c, std::size_t n) {
+    for (std::size_t i = blockIdx.x * (std::size_t)blockDim.x + threadIdx.x; i < n; i += (std::size_t)gridDim.x * blockDim.x) {
+        c[i] = a[i] + b[i];
+    }
+}
+
+// Сколько первых k элементов результата слияния берётся из a (при равенстве a идёт раньше b — устойчиво)
+__device__ std::size_t coRank(std::size_t k, const int* a, std::size_t na, const int* b, std::size_t nb) {
+    std::size_t lo = k > nb ? k - nb : 0;
+    std::size_t hi = k < na ? k : na;
+    while (lo < hi) {
+        std::size_t i = lo + (hi - lo) / 2;
+        if (a[i] <= b[k - i - 1]) lo = i + 1;                   // a[i] попадает в первые k — берём больше из a
+        else hi = i;
+    }
+    return lo;
+}
+
+// Слияние по merge path: поток пишет out[k0..k1)
+__global__ void mergePathKernel(const int* a, std::size_t na, const int* b, std::size_t nb, int* out) {
+    std::size_t total = na + nb;
+    std::size_t k0 = (blockIdx.x * (std::size_t)blockDim.x + threadIdx.x) * CUDA_MERGE_ITEMS;
+    if (k0 >= total) return;
+    std::size_t k1 = k0 + CUDA_MERGE_ITEMS < total ? k0 + CUDA_MERGE_ITEMS : total;
+
+    std::size_t i = coRank(k0, a, na, b, nb), j = k0 - i;
+    std::size_t iEnd = coRank(k1, a, na, b, nb), jEnd = k1 - iEnd;
+    for (std::size_t k = k0; k < k1; ++k) {
+        if (j >= jEnd || (i < iEnd && a[i] <= b[j])) out[k] = a[i++];
+        else out[k] = b[j++];
+    }
+}
+
+// Исключающий скан на устройстве для массива любого размера (суммы блоков — рекурсивно)
+void scanDevice(const int* input, int* output, std::size_t n) {
+    std::size_t blocks = (n + CUDA_SCAN_BLOCK - 1) / CUDA_SCAN_BLOCK;
+    DeviceBuffer<int> sums(blocks);
+    prefixSumKernel<<<blocks, CUDA_SCAN_BLOCK, CUDA_SCAN_BLOCK * sizeof(int)>>>(input, output, sums.ptr, n);
+    CUDA_CHECK(cudaGetLastError());
+    if (blocks > 1) {
+        DeviceBuffer<int> scannedSums(blocks);
+        scanDevice(sums.ptr, scannedSums.ptr, blocks);
+        addBlockSums<<<blocks, CUDA_SCAN_BLOCK>>>(output, scannedSums.ptr, n);
+        CUDA_CHECK(cudaGetLastError());
+    }
+}
+
+class CudaBackend : public ComputeBackend {
+public:
+    const char* name() const override { return "cuda"; }
+
+    long long reduceSum(const int* data, std::size_t n) override {
+        if (n == 0) return 0;
+        DeviceBuffer<int> d(n);
+        DeviceBuffer<unsigned long long> result(1);
+        d.upload(data, n);
+        CUDA_CHECK(cudaMemset(result.ptr, 0, sizeof(unsigned long long)));
+        reductionKernel<<<gridSize(n, CUDA_BLOCK_SIZE, CUDA_MAX_BLOCKS), CUDA_BLOCK_SIZE>>>(d.ptr, result.ptr, n);
+        CUDA_CHECK(cudaGetLastError());
+        unsigned long long sum = 0;
+        result.download(&sum, 1);
+        return static_cast<long long>(sum);
+    }
+
+    void scan(const int* in, int* out, std::size_t n, bool inclusive) override {
+        if (n == 0) return;
+        DeviceBuffer<int> dIn(n), dOut(n);
+        dIn.upload(in, n);
+        scanDevice(dIn.ptr, dOut.ptr, n);
+        if (inclusive) {
+            exclusiveToInclusive<<<gridSize(n, CUDA_BLOCK_SIZE, CUDA_MAX_BLOCKS), CUDA_BLOCK_SIZE>>>(dIn.ptr, dOut.ptr, n);
+            CUDA_CHECK(cudaGetLastError());
+        }
+        dOut.download(out, n);
+    }
+
+    void mapScale(float* data, std::size_t n, float k) override {
+        if (n == 0) return;
+        DeviceBuffer<float> d(n);
+        d.upload(data, n);
+        scaleKernel<<<gridSize(n, CUDA_BLOCK_SIZE, CUDA_MAX_BLOCKS), CUDA_BLOCK_SIZE>>>(d.ptr, k, n);
+        CUDA_CHECK(cudaGetLastError());
+        d.download(data, n);
+    }
+
+    void mapAdd(const float* a, const float* b, float* c, std::size_t n) override {
+        if (n == 0) return;
+        DeviceBuffer<float> dA(n), dB(n), dC(n);
+        dA.upload(a, n);
+        dB.upload(b, n);
+        vectorAddKernel<<<gridSize(n, CUDA_BLOCK_SIZE, CUDA_MAX_BLOCKS), CUDA_BLOCK_SIZE>>>(dA.ptr, dB.ptr, dC.ptr, n);
+        CUDA_CHECK(cudaGetLastError());
+        dC.download(c, n);
+    }
+
+    void sort(int* data, std::size_t n) override {
+        if (n < 2) return;
+        DeviceBuffer<int> d(n);
+        d.upload(data, n);
+        thrust::sort(thrust::device, d.ptr, d.ptr + n);
+        CUDA_CHECK(cudaGetLastError());
+        d.download(data, n);
+    }
+
+    void merge(const int* a, std::size_t na, const int* b, std::size_t nb, int* out) override {
+        std::size_t total = na + nb;
+        if (total == 0) return;
+        DeviceBuffer<int> dA(na), dB(nb), dOut(total);
+        dA.upload(a, na);
+        dB.upload(b, nb);
+        std::size_t threads = (total + CUDA_MERGE_ITEMS - 1) / CUDA_MERGE_ITEMS;
+        std::size_t blocks = (threads + CUDA_BLOCK_SIZE - 1) / CUDA_BLOCK_SIZE;
+        mergePathKernel<<<blocks, CUDA_BLOCK_SIZE>>>(dA.ptr, na, dB.ptr, nb, dOut.ptr);
+        CUDA_CHECK(cudaGetLastError());
+        dOut.download(out, total);
+    }
+};
+
+std::unique_ptr<ComputeBackend> createCudaBackend() {
+    int devices = 0;
+    if (cudaGetDeviceCount(&devices) != cudaSuccess || devices == 0) return nullptr;
+    return std::unique_ptr<ComputeBackend>(new CudaBackend());
+}
+
+#endif
@@ -0,0 +1,162 @@
+// Общая библиотека: параллельная генерация массивов со счётчиковым генератором случайных чисел
+// Раньше каждая программа заполняла массив последовательно одним mt19937 с зерном из random_device:
+// на 5 млн элементов генерация занимала больше времени, чем сам алгоритм, а запуски нельзя было повторить. Здесь:
+//   - генератор счётчиковый (counter-based, SplitMix64): i-е число — хеш от (зерно, i), состояния нет,
+//     поэтому любой поток заполняет любой кусок массива независимо от остальных;
+//   - результат побитово одинаков при любом числе потоков и совпадает с последовательным потоком SplitMix64;
+//   - зерно фиксировано (GENERATOR_DEFAULT_SEED), поэтому одинаковые запуски дают одинаковые данные;
+//   - распределения для тестирования сортировок: случайное, отсортированное, обратное,
+//     почти отсортированное и с небольшим числом различных значений.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <cstdint>       // Для uint64_t
+#include <string>        // Для имён распределений
+#include <vector>        // Для vector
+#include <type_traits>   // Для is_integral / is_floating_point
+#include <omp.h>         // Для OpenMP
+
+const std::uint64_t GENERATOR_DEFAULT_SEED = 20240901;    // Зерно по умолчанию (одинаковые данные в каждом запуске)
+const std::uint64_t GENERATOR_GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull; // Шаг счётчика SplitMix64
+const std::size_t GENERATOR_SEQUENTIAL_CUTOFF = 1 << 15;  // Ниже этого размера массив заполняет один поток
+const unsigned GENERATOR_NEARLY_SORTED_PERMILLE = 10;     // Почти отсортированный: 10 из 1000 элементов случайные
+const std::size_t GENERATOR_FEW_UNIQUE_VALUES = 16;       // Количество различных значений в FewUnique
+
+// Распределение значений массива
+enum class Distribution {
+    Uniform,          // Равномерно случайные значения из [lo, hi]
+    Sorted,           // Неубывающая последовательность от lo до hi
+    ReverseSorted,    // Невозрастающая последовательность от hi до lo
+    NearlySorted,     // Отсортированный массив, 1% элементов заменён случайными значениями
+    FewUnique         // Случайные значения из 16 различных (много повторов)
+};
+
+inline const char* distributionName(Distribution d) {
+    switch (d) {
+        case Distribution::Uniform:       return "uniform";
+        case Distribution::Sorted:        return "sorted";
+        case Distribution::ReverseSorted: return "reverse";
+        case Distribution::NearlySorted:  return "nearly-sorted";
+        case Distribution::FewUnique:     return "few-unique";
+    }
+    return "unknown";
+}
+
+// Распределение по имени (для аргументов командной строки); false, если имя неизвестно
+inline bool parseDistribution(const std::string& name, Distribution& d) {
+    const Distribution all[] = {Distribution::Uniform, Distribution::Sorted, Distribution::ReverseSorted,
+                                Distribution::NearlySorted, Distribution::FewUnique};
+    for (Distribution candidate : all) {
+        if (name == distributionName(candidate)) {
+            d = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Перемешивающая функция SplitMix64: биективный хеш 64-битного слова
+inline std::uint64_t splitMix64(std::uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+
+// i-е случайное число потока с зерном seed (равно i-му выходу последовательного SplitMix64)
+inline std::uint64_t counterRandom(std::uint64_t seed, std::uint64_t index) {
+    return splitMix64(seed + (index + 1) * GENERATOR_GOLDEN_GAMMA);
+}
+
+// Зерно независимого подпотока (например, для выбора "испорченных" позиций в NearlySorted)
+inline std::uint64_t substreamSeed(std::uint64_t seed, std::uint64_t stream) {
+    return splitMix64(seed ^ splitMix64(stream + GENERATOR_GOLDEN_GAMMA));
+}
+
+// Случайное 64-битное слово r -> значение из [lo, hi]
+template <typename T>
+inline T uniformFromBits(std::uint64_t r, T lo, T hi) {
+    if constexpr (std::is_floating_point<T>::value) {
+        double unit = static_cast<double>(r >> 11) * 0x1.0p-53;        // 53 случайных бита -> [0, 1)
+        return static_cast<T>(lo + (hi - lo) * unit);
+    } else {
+        static_assert(std::is_integral<T>::value && sizeof(T) <= 8, "генератор: нужен целый тип до 64 бит");
+        std::uint64_t range = static_cast<std::uint64_t>(hi) - static_cast<std::uint64_t>(lo) + 1; // 0 — весь диапазон
+        std::uint64_t offset;
+        if (range == 0) offset = r;
+        else if (range <= (1ull << 32)) offset = ((r >> 32) * range) >> 32; // Умножение вместо деления по модулю
+        else offset = r % range;
+        return static_cast<T>(static_cast<std::uint64_t>(lo) + offset);
+    }
+}
+
+// Линейная "лестница": значение позиции i из n, монотонно от lo (i = 0) до hi (i = n - 1)
+template <typename T>
+inline T rampValue(std::size_t i, std::size_t n, T lo, T hi) {
+    long double t = n > 1 ? static_cast<long double>(i) / static_cast<long double>(n - 1) : 0.0L;
+    if constexpr (std::is_floating_point<T>::value) {
+        return static_cast<T>(lo + (hi - lo) * t);
+    } else {
+        long double span = static_cast<long double>(static_cast<std::uint64_t>(hi) - static_cast<std::uint64_t>(lo));
+        return static_cast<T>(static_cast<std::uint64_t>(lo) + static_cast<std::uint64_t>(span * t));
+    }
+}
+
+// Заполнение куска [first, first + count) массива из n элементов: data[k] — значение позиции first + k.
+// Значение позиции зависит только от (seed, i), поэтому кусок совпадает с тем же куском полного массива
+// (процесс MPI генерирует свою часть сам, без рассылки)
+template <typename T>
+void generateArraySlice(T* data, std::size_t first, std::size_t count, std::size_t n, Distribution dist, T lo, T hi,
+                        std::uint64_t seed = GENERATOR_DEFAULT_SEED) {
+    T fewValues[GENERATOR_FEW_UNIQUE_VALUES];                             // Значения для FewUnique
+    std::uint64_t valueSeed = substreamSeed(seed, 1);                     // Подпоток значений
+    for (std::size_t k = 0; k < GENERATOR_FEW_UNIQUE_VALUES; ++k) {
+        fewValues[k] = uniformFromBits(counterRandom(valueSeed, k), lo, hi);
+    }
+
+    #pragma omp parallel for schedule(static) if (count >= GENERATOR_SEQUENTIAL_CUTOFF)
+    for (std::size_t k = 0; k < count; ++k) {
+        std::size_t i = first + k;
+        std::uint64_t r = counterRandom(seed, i);
+        switch (dist) {
+            case Distribution::Uniform:
+                data[k] = uniformFromBits(r, lo, hi);
+                break;
+            case Distribution::Sorted:
+                data[k] = rampValue(i, n, lo, hi);
+                break;
+            case Distribution::ReverseSorted:
+                data[k] = rampValue(n - 1 - i, n, lo, hi);
+                break;
+            case Distribution::NearlySorted:                              // Младшие биты решают, испорчена ли позиция
+                data[k] = (r % 1000 < GENERATOR_NEARLY_SORTED_PERMILLE)
+                        ? uniformFromBits(counterRandom(valueSeed, i), lo, hi)
+                        : rampValue(i, n, lo, hi);
+                break;
+            case Distribution::FewUnique:
+                data[k] = fewValues[r % GENERATOR_FEW_UNIQUE_VALUES];
+                break;
+        }
+    }
+}
+
+// Заполнение data[0..n): значение каждой позиции зависит только от (seed, i), поэтому цикл делится на потоки произвольно
+template <typename T>
+void generateArray(T* data, std::size_t n, Distribution dist, T lo, T hi,
+                   std::uint64_t seed = GENERATOR_DEFAULT_SEED) {
+    generateArraySlice(data, 0, n, n, dist, lo, hi, seed);
+}
+
+template <typename T>
+void generateArray(std::vector<T>& arr, Distribution dist, T lo, T hi,
+                   std::uint64_t seed = GENERATOR_DEFAULT_SEED) {
+    generateArray(arr.data(), arr.size(), dist, lo, hi, seed);
+}
+
+template <typename T>
+std::vector<T> generateArray(std::size_t n, Distribution dist, T lo, T hi,
+                             std::uint64_t seed = GENERATOR_DEFAULT_SEED) {
+    std::vector<T> arr(n);
+    generateArray(arr.data(), n, dist, lo, hi, seed);
+    return arr;
+}
@@ -0,0 +1,276 @@
+// Общая библиотека: адаптивный выбор последовательного или параллельного исполнения
+// В assignment2task2.cpp прямо сказано, что на 10 000 элементах OpenMP-версия может проиграть из-за накладных
+// расходов, а пороги в reduction.h и parallel_sort.h — константы, подобранные на одной машине. Здесь:
+//   - для редукций и сортировок выбирается режим: Sequential (без fork/join), OmpStatic (команда потоков
+//     со статическим разбиением) или Tasks (задачи OpenMP);
+//   - пороги размеров находятся один раз коротким микро-замером (калибровкой) для текущего числа потоков:
+//     по каждому размеру измеряются все режимы, порог — точка окупаемости (findCrossover из scaling.h);
+//     параллельные версии замеряются без своих внутренних порогов (sequentialCutoff / taskCutoff), и
+//     dispatchSort / dispatchReduce вызывают их с теми же параметрами, что и при калибровке;
+//   - результат калибровки сохраняется в локальный файл (hp_dispatch.cache или путь из HP_DISPATCH_CACHE)
+//     с ключом машины (имя узла, модель процессора, компилятор, версия формата), следующие запуски на той же
+//     машине читают его и не замеряют заново; файл, скопированный на другой узел, не используется;
+//   - маленькие вызовы никогда не создают команду потоков, большие (выше диапазона калибровки) всегда параллельны.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <cstdlib>       // Для getenv
+#include <string>        // Для пути к файлу
+#include <vector>        // Для замеров
+#include <map>           // Для порогов по числу потоков
+#include <mutex>         // Для защиты кэша порогов
+#include <fstream>       // Для файла калибровки
+#include <sstream>       // Для разбора строк файла
+#include <algorithm>     // Для sort, min, max, replace
+#include <unistd.h>      // Для gethostname
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"       // Для parallelReduce / reduceRange
+#include "parallel_sort.h"   // Для parallelMergeSort / parallelSampleSort
+#include "benchmark.h"       // Для runBenchmark
+#include "scaling.h"         // Для ScalingPoint / findCrossover
+#include "data_generator.h"  // Для данных калибровки
+
+const std::size_t DISPATCH_MIN_SIZE = 1 << 10;             // Наименьший размер калибровки
+const std::size_t DISPATCH_MAX_REDUCE_SIZE = 1 << 22;      // Наибольший размер калибровки редукций
+const std::size_t DISPATCH_MAX_SORT_SIZE = 1 << 20;        // Наибольший размер калибровки сортировок
+const std::size_t DISPATCH_NEVER = static_cast<std::size_t>(-1); // Порог "никогда" (один поток)
+const char* const DISPATCH_CACHE_FILE = "hp_dispatch.cache";    // Файл калибровки по умолчанию
+const std::size_t DISPATCH_TASKS_PER_THREAD = 4;           // Задач сортировки слиянием на поток (не меньше)
+const int DISPATCH_CACHE_FORMAT = 2;                       // Версия формата записи и способа калибровки
+
+// Режим исполнения
+enum class ExecutionMode { Sequential, OmpStatic, Tasks };
+
+inline const char* executionModeName(ExecutionMode mode) {
+    switch (mode) {
+        case ExecutionMode::Sequential: return "sequential";
+        case ExecutionMode::OmpStatic:  return "omp static";
+        case ExecutionMode::Tasks:      return "omp tasks";
+    }
+    return "unknown";
+}
+
+// Пороги для одного числа потоков: n < reduceParallel — редукция последовательно;
+// n < sortParallel — std::sort, n < sortStatic — сортировка слиянием на задачах, иначе samplesort
+struct DispatchThresholds {
+    int threads = 1;
+    std::size_t reduceParallel = DISPATCH_NEVER;
+    std::size_t sortParallel = DISPATCH_NEVER;
+    std::size_t sortStatic = DISPATCH_NEVER;
+};
+
+// Размер куска, ниже которого сортировка слиянием не порождает задачи: SORT_TASK_CUTOFF, а на массивах,
+// где так задач меньше DISPATCH_TASKS_PER_THREAD на поток, — мельче (одинаково при калибровке и в dispatchSort)
+inline std::size_t dispatchTaskCutoff(std::size_t n, int threads) {
+    std::size_t perTask = n / (DISPATCH_TASKS_PER_THREAD * static_cast<std::size_t>(threads > 0 ? threads : 1));
+    return std::min(SORT_TASK_CUTOFF, std::max(perTask, SORT_INSERTION_CUTOFF));
+}
+
+// Ключ машины: пороги, замеренные на другом узле, процессоре, другим компилятором или старой калибровкой, не подходят;
+// время сборки в ключ не входит — пересборка той же программы не сбрасывает калибровку
+inline std::string dispatchMachineKey() {
+    char host[256] = {0};
+    if (gethostname(host, sizeof(host) - 1) != 0) host[0] = 0;
+    std::string cpu = "unknown";
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.compare(0, 10, "model name") == 0) {                  // "model name\t: Intel(R) ..."
+            std::size_t colon = line.find(':');
+            if (colon != std::string::npos && colon + 2 <= line.size()) cpu = line.substr(colon + 2);
+            break;
+        }
+    }
+#if defined(__VERSION__)
+    std::string compiler = __VERSION__;
+#else
+    std::string compiler = "unknown";
+#endif
+    std::string key = std::string("host=") + (host[0] ? host : "unknown") + ";cpu=" + cpu + ";compiler=" + compiler
+                    + ";format=" + std::to_string(DISPATCH_CACHE_FORMAT);
+    std::replace(key.begin(), key.end(), ' ', '_');                    // Ключ — одно поле строки файла
+    std::replace(key.begin(), key.end(), '\t', '_');
+    return key;
+}
+
+// Путь к файлу калибровки
+inline std::string dispatchCachePath() {
+    const char* env = std::getenv("HP_DISPATCH_CACHE");
+    return env && *env ? std::string(env) : std::string(DISPATCH_CACHE_FILE);
+}
+
+// Чтение порогов для threads потоков и ключа машины key из файла; false — записи нет
+inline bool loadDispatchThresholds(const std::string& path, int threads, const std::string& key, DispatchThresholds& t) {
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;                  // Комментарий
+        std::istringstream fields(line);
+        DispatchThresholds candidate;
+        std::string candidateKey;                                      // В старых записях ключа нет — они пропускаются
+        if (fields >> candidate.threads >> candidate.reduceParallel >> candidate.sortParallel >> candidate.sortStatic
+            >> candidateKey && candidate.threads == threads && candidateKey == key) {
+            t = candidate;
+        }
+    }
+    return t.threads == threads;
+}
+
+// Запись порогов в файл: файл переписывается, запись с тем же числом потоков и ключом заменяется,
+// записи без ключа (старый формат) отбрасываются — файл не растёт от запуска к запуску
+// (ошибка записи не мешает работе — пороги останутся в памяти)
+inline void saveDispatchThresholds(const std::string& path, const std::string& key, const DispatchThresholds& t) {
+    std::vector<std::string> kept;                                     // Записи других машин и чисел потоков
+    {
+        std::ifstream in(path);
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.empty() || line[0] == '#') continue;
+            std::istringstream fields(line);
+            DispatchThresholds other;
+            std::string otherKey;
+            if (!(fields >> other.threads >> other.reduceParallel >> other.sortParallel >> other.sortStatic >> otherKey)) continue;
+            if (other.threads == t.threads && otherKey == key) continue;
+            kept.push_back(line);
+        }
+    }
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) return;
+    out << "# threads reduce_parallel sort_parallel sort_static machine_key\n";
+    for (const std::string& line : kept) out << line << "\n";
+    out << t.threads << " " << t.reduceParallel << " " << t.sortParallel << " " << t.sortStatic << " " << key << "\n";
+}
+
+// Порог по точкам: наименьший размер, начиная с которого вторая версия быстрее первой;
+// если не окупается в диапазоне — последний размер (выше диапазона всегда параллельно)
+inline std::size_t crossoverOrLast(const std::vector<ScalingPoint>& points) {
+    std::size_t crossover = findCrossover(points);
+    return crossover ? crossover : points.back().n * 2;
+}
+
+// Калибровка для текущего числа потоков: по каждому размеру медианы всех режимов
+inline DispatchThresholds calibrateDispatch() {
+    DispatchThresholds t;
+    t.threads = omp_get_max_threads();
+    if (t.threads < 2) return t;                                       // Один поток — всегда последовательно
+
+    BenchmarkOptions opt;
+    opt.warmup = 1;
+    opt.repetitions = 5;
+    std::vector<int> data = generateArray(DISPATCH_MAX_REDUCE_SIZE, Distribution::Uniform, 0, 1 << 30);
+
+    // Редукции: reduceRange в одном потоке против parallelReduce без порога
+    std::vector<ScalingPoint> reducePoints;
+    for (std::size_t n = DISPATCH_MIN_SIZE; n <= DISPATCH_MAX_REDUCE_SIZE; n *= 4) {
+        ScalingPoint pt;
+        pt.n = n;
+        pt.sequentialMs = runBenchmark("", "", n, 0, opt, [&] { doNotOptimize(reduceRange(data.data(), 0, n)); }).medianMs;
+        pt.parallelMs = runBenchmark("", "", n, 0, opt, [&] { doNotOptimize(parallelReduce(data.data(), n, 0)); }).medianMs;
+        pt.speedup = pt.parallelMs > 0 ? pt.sequentialMs / pt.parallelMs : 0;
+        reducePoints.push_back(pt);
+    }
+    t.reduceParallel = crossoverOrLast(reducePoints);
+
+    // Сортировки: std::sort против лучшего параллельного режима; задачи (слияние) против статического (samplesort)
+    std::vector<ScalingPoint> parallelPoints, staticPoints;
+    std::vector<int> work;
+    for (std::size_t n = DISPATCH_MIN_SIZE; n <= DISPATCH_MAX_SORT_SIZE; n *= 4) {
+        auto restore = [&] { work.assign(data.begin(), data.begin() + n); };
+        double seqMs = runBenchmark("", "", n, 0, opt, restore, [&] { std::sort(work.begin(), work.end()); }).medianMs;
+        std::size_t taskCutoff = dispatchTaskCutoff(n, t.threads);     // Без порогов SORT_TASK_CUTOFF внутри сортировок
+        double taskMs = runBenchmark("", "", n, 0, opt, restore, [&] { parallelMergeSort(work, taskCutoff); }).medianMs;
+        double staticMs = runBenchmark("", "", n, 0, opt, restore, [&] { parallelSampleSort(work, 0); }).medianMs;
+        double bestParallel = taskMs < staticMs ? taskMs : staticMs;
+
+        ScalingPoint p;
+        p.n = n;
+        p.speedup = bestParallel > 0 ? seqMs / bestParallel : 0;
+        parallelPoints.push_back(p);
+        ScalingPoint s;
+        s.n = n;
+        s.speedup = staticMs > 0 ? taskMs / staticMs : 0;
+        staticPoints.push_back(s);
+    }
+    t.sortParallel = crossoverOrLast(parallelPoints);
+    t.sortStatic = crossoverOrLast(staticPoints);
+    if (t.sortStatic < t.sortParallel) t.sortStatic = t.sortParallel;  // Задачи не выигрывают — сразу samplesort
+    return t;
+}
+
+// Пороги для текущего числа потоков: из памяти, из файла или калибровкой (один раз на число потоков)
+inline DispatchThresholds dispatchThresholds() {
+    static std::mutex mutex;
+    static std::map<int, DispatchThresholds> cache;
+    int threads = omp_get_max_threads();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(threads);
+    if (it != cache.end()) return it->second;
+
+    DispatchThresholds t;
+    if (threads < 2) {
+        t.threads = threads;                                           // Калибровать нечего
+    } else {
+        std::string key = dispatchMachineKey();
+        if (!loadDispatchThresholds(dispatchCachePath(), threads, key, t)) {
+            t = calibrateDispatch();
+            saveDispatchThresholds(dispatchCachePath(), key, t);
+        }
+    }
+    cache[threads] = t;
+    return t;
+}
+
+// Режим редукции для n элементов
+inline ExecutionMode reduceMode(std::size_t n) {
+    return n < dispatchThresholds().reduceParallel ? ExecutionMode::Sequential : ExecutionMode::OmpStatic;
+}
+
+// Режим сортировки для n элементов
+inline ExecutionMode sortMode(std::size_t n) {
+    DispatchThresholds t = dispatchThresholds();
+    if (n < t.sortParallel) return ExecutionMode::Sequential;
+    return n < t.sortStatic ? ExecutionMode::Tasks : ExecutionMode::OmpStatic;
+}
+
+// Редукция с выбором режима: маленький массив — один проход без команды потоков
+template <typename T>
+ReductionResult<T> dispatchReduce(const T* data, std::size_t n) {
+    if (reduceMode(n) == ExecutionMode::Sequential) return reduceRange(data, 0, n);
+    return parallelReduce(data, n, 0);
+}
+
+template <typename T>
+SumType<T> dispatchSum(const T* data, std::size_t n) {
+    return dispatchReduce(data, n).sum;
+}
+
+template <typename T>
+std::pair<T, T> dispatchMinMax(const T* data, std::size_t n) {
+    ReductionResult<T> r = dispatchReduce(data, n);
+    return std::make_pair(r.minValue, r.maxValue);
+}
+
+// Сортировка с выбором режима
+template <typename T>
+void dispatchSort(T* data, std::size_t n) {
+    switch (sortMode(n)) {
+        case ExecutionMode::Sequential: std::sort(data, data + n); break;
+        case ExecutionMode::Tasks:      parallelMergeSort(data, n, dispatchTaskCutoff(n, omp_get_max_threads())); break;
+        case ExecutionMode::OmpStatic:  parallelSampleSort(data, n, 0); break;
+    }
+}
+
+// Перегрузки для vector
+template <typename T>
+ReductionResult<T> dispatchReduce(const std::vector<T>& v) { return dispatchReduce(v.data(), v.size()); }
+
+template <typename T>
+SumType<T> dispatchSum(const std::vector<T>& v) { return dispatchSum(v.data(), v.size()); }
+
+template <typename T>
+std::pair<T, T> dispatchMinMax(const std::vector<T>& v) { return dispatchMinMax(v.data(), v.size()); }
+
+template <typename T>
+void dispatchSort(std::vector<T>& v) { dispatchSort(v.data(), v.size()); }
@@ -0,0 +1,271 @@
+// Общая библиотека: ленивые поэлементные выражения (expression templates) — цепочка map-ядер за один проход
+// multiply_global / multiply_shared (Assignment3_task1), vector_add (Assignment3_task2) и coalesced_kernel (input * 2 + 1,
+// Assignment3_task3) — каждое отдельный проход по всему массиву с записью результата в память. Цепочка из них
+// (c = a * k; d = c + b; out = d * 2 + 1) читает и пишет промежуточные массивы, то есть гоняет данные через память
+// несколько раз. Здесь выражение над массивами только описывается, а вычисляется одним циклом:
+//   - lazy(data, n) / lazy(vector) — лист выражения (указатель и размер, данные не копируются);
+//   - операторы + - * / и унарный минус, сравнения < <= > >= == !=, minimum / maximum, where(cond, a, b) над
+//     выражениями и числами строят дерево типов; значения промежуточных узлов существуют только в регистрах;
+//   - evaluate(expr, out) — один проход omp parallel for simd по всем элементам (маленькие массивы — один поток);
+//     out может совпадать с одним из входов (элемент i зависит только от элементов i входов);
+//   - sumOf / minOf / maxOf / countOf — редукции над выражением, тоже за один проход без промежуточного массива;
+//   - размеры листьев проверяются при построении выражения (invalid_argument), числа подходят к любому размеру.
+// Пример: evaluate((lazy(a) * k + lazy(b)) * 2.0f + 1.0f, out) — три ядра блокнотов за одно чтение a, b и одну запись out.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <vector>        // Для перегрузок с vector
+#include <limits>        // Для numeric_limits
+#include <stdexcept>     // Для invalid_argument
+#include <type_traits>   // Для enable_if / is_arithmetic / common_type
+#include <utility>       // Для declval
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"   // Для SumType
+
+const std::size_t EXPRESSION_SEQUENTIAL_CUTOFF = 1 << 15;    // Ниже этого размера выражение вычисляет один поток
+const std::size_t EXPRESSION_ANY_SIZE = static_cast<std::size_t>(-1);  // Размер числа: подходит к любому массиву
+
+// Базовый класс выражений (CRTP): операторы принимают только наследников Expr, а не любые типы
+template <typename E>
+struct Expr {
+    const E& self() const { return static_cast<const E&>(*this); }
+};
+
+// Общий размер двух операндов
+inline std::size_t exprCombineSize(std::size_t a, std::size_t b) {
+    if (a == EXPRESSION_ANY_SIZE) return b;
+    if (b == EXPRESSION_ANY_SIZE) return a;
+    if (a != b) throw std::invalid_argument("expression: размеры массивов в выражении различаются");
+    return a;
+}
+
+// Лист: массив
+template <typename T>
+struct ArrayExpr : Expr<ArrayExpr<T>> {
+    using value_type = T;
+    const T* data;
+    std::size_t n;
+
+    ArrayExpr(const T* data, std::size_t n) : data(data), n(n) {}
+    T operator[](std::size_t i) const { return data[i]; }
+    std::size_t size() const { return n; }
+};
+
+// Лист: число, одинаковое для всех элементов
+template <typename T>
+struct ScalarExpr : Expr<ScalarExpr<T>> {
+    using value_type = T;
+    T value;
+
+    explicit ScalarExpr(T value) : value(value) {}
+    T operator[](std::size_t) const { return value; }
+    std::size_t size() const { return EXPRESSION_ANY_SIZE; }
+};
+
+// Узел с двумя операндами; Op::apply — сама операция
+template <typename Op, typename L, typename R>
+struct BinaryExpr : Expr<BinaryExpr<Op, L, R>> {
+    using value_type = decltype(Op::apply(std::declval<typename L::value_type>(), std::declval<typename R::value_type>()));
+    L left;
+    R right;
+    std::size_t n;
+
+    BinaryExpr(const L& left, const R& right) : left(left), right(right), n(exprCombineSize(left.size(), right.size())) {}
+    value_type operator[](std::size_t i) const { return Op::apply(left[i], right[i]); }
+    std::size_t size() const { return n; }
+};
+
+// Узел с одним операндом
+template <typename Op, typename A>
+struct UnaryExpr : Expr<UnaryExpr<Op, A>> {
+    using value_type = decltype(Op::apply(std::declval<typename A::value_type>()));
+    A arg;
+
+    explicit UnaryExpr(const A& arg) : arg(arg) {}
+    value_type operator[](std::size_t i) const { return Op::apply(arg[i]); }
+    std::size_t size() const { return arg.size(); }
+};
+
+// where(cond, a, b): cond[i] ? a[i] : b[i]; обе ветви вычисляются (без ветвлений — смешивание SIMD-регистров)
+template <typename C, typename A, typename B>
+struct WhereExpr : Expr<WhereExpr<C, A, B>> {
+    using value_type = typename std::common_type<typename A::value_type, typename B::value_type>::type;
+    C cond;
+    A ifTrue;
+    B ifFalse;
+    std::size_t n;
+
+    WhereExpr(const C& cond, const A& ifTrue, const B& ifFalse)
+        : cond(cond), ifTrue(ifTrue), ifFalse(ifFalse),
+          n(exprCombineSize(cond.size(), exprCombineSize(ifTrue.size(), ifFalse.size()))) {}
+    value_type operator[](std::size_t i) const {
+        value_type a = ifTrue[i];
+        value_type b = ifFalse[i];
+        return cond[i] ? a : b;
+    }
+    std::size_t size() const { return n; }
+};
+
+// Операции
+struct ExprAdd { template <typename A, typename B> static auto apply(A a, B b) -> decltype(a + b) { return a + b; } };
+struct ExprSub { template <typename A, typename B> static auto apply(A a, B b) -> decltype(a - b) { return a - b; } };
+struct ExprMul { template <typename A, typename B> static auto apply(A a, B b) -> decltype(a * b) { return a * b; } };
+struct ExprDiv { template <typename A, typename B> static auto apply(A a, B b) -> decltype(a / b) { return a / b; } };
+struct ExprLess { template <typename A, typename B> static bool apply(A a, B b) { return a < b; } };
+struct ExprLessEqual { template <typename A, typename B> static bool apply(A a, B b) { return a <= b; } };
+struct ExprGreater { template <typename A, typename B> static bool apply(A a, B b) { return a > b; } };
+struct ExprGreaterEqual { template <typename A, typename B> static bool apply(A a, B b) { return a >= b; } };
+struct ExprEqual { template <typename A, typename B> static bool apply(A a, B b) { return a == b; } };
+struct ExprNotEqual { template <typename A, typename B> static bool apply(A a, B b) { return a != b; } };
+struct ExprMin {
+    template <typename A, typename B>
+    static auto apply(A a, B b) -> typename std::common_type<A, B>::type { return b < a ? b : a; }
+};
+struct ExprMax {
+    template <typename A, typename B>
+    static auto apply(A a, B b) -> typename std::common_type<A, B>::type { return a < b ? b : a; }
+};
+struct ExprNegate { template <typename A> static auto apply(A a) -> decltype(-a) { return -a; } };
+
+// Листья
+template <typename T>
+ArrayExpr<T> lazy(const T* data, std::size_t n) { return ArrayExpr<T>(data, n); }
+
+template <typename T>
+ArrayExpr<T> lazy(const std::vector<T>& v) { return ArrayExpr<T>(v.data(), v.size()); }
+
+// Число как выражение (для where и minimum / maximum с числом)
+template <typename T>
+ScalarExpr<T> constant(T value) { return ScalarExpr<T>(value); }
+
+// Операторы: выражение с выражением, выражение с числом и число с выражением
+#define EXPRESSION_BINARY_OPERATOR(symbol, Op)                                                                        \
+    template <typename L, typename R>                                                                                 \
+    BinaryExpr<Op, L, R> operator symbol(const Expr<L>& l, const Expr<R>& r) {                                        \
+        return BinaryExpr<Op, L, R>(l.self(), r.self());                                                              \
+    }                                                                                                                 \
+    template <typename L, typename S, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>        \
+    BinaryExpr<Op, L, ScalarExpr<S>> operator symbol(const Expr<L>& l, S s) {                                        \
+        return BinaryExpr<Op, L, ScalarExpr<S>>(l.self(), ScalarExpr<S>(s));                                         \
+    }                                                                                                                 \
+    template <typename S, typename R, typename = typename std::enable_if<std::is_arithmetic<S>::value>::type>        \
+    BinaryExpr<Op, ScalarExpr<S>, R> operator symbol(S s, const Expr<R>& r) {                                        \
+        return BinaryExpr<Op, ScalarExpr<S>, R>(ScalarExpr<S>(s), r.self());                                         \
+    }
+
+EXPRESSION_BINARY_OPERATOR(+, ExprAdd)
+EXPRESSION_BINARY_OPERATOR(-, ExprSub)
+EXPRESSION_BINARY_OPERATOR(*, ExprMul)
+EXPRESSION_BINARY_OPERATOR(/, ExprDiv)
+EXPRESSION_BINARY_OPERATOR(<, ExprLess)
+EXPRESSION_BINARY_OPERATOR(<=, ExprLessEqual)
+EXPRESSION_BINARY_OPERATOR(>, ExprGreater)
+EXPRESSION_BINARY_OPERATOR(>=, ExprGreaterEqual)
+EXPRESSION_BINARY_OPERATOR(==, ExprEqual)
+EXPRESSION_BINARY_OPERATOR(!=, ExprNotEqual)
+
+#undef EXPRESSION_BINARY_OPERATOR
+
+template <typename A>
+UnaryExpr<ExprNegate, A> operator-(const Expr<A>& a) { return UnaryExpr<ExprNegate, A>(a.self()); }
+
+template <typename L, typename R>
+BinaryExpr<ExprMin, L, R> minimum(const Expr<L>& l, const Expr<R>& r) { return BinaryExpr<ExprMin, L, R>(l.self(), r.self()); }
+
+template <typename L, typename R>
+BinaryExpr<ExprMax, L, R> maximum(const Expr<L>& l, const Expr<R>& r) { return BinaryExpr<ExprMax, L, R>(l.self(), r.self()); }
+
+template <typename C, typename A, typename B>
+WhereExpr<C, A, B> where(const Expr<C>& cond, const Expr<A>& ifTrue, const Expr<B>& ifFalse) {
+    return WhereExpr<C, A, B>(cond.self(), ifTrue.self(), ifFalse.self());
+}
+
+// Размер выражения; выражение только из чисел размера не имеет
+template <typename E>
+std::size_t expressionSize(const Expr<E>& expr) {
+    std::size_t n = expr.self().size();
+    if (n == EXPRESSION_ANY_SIZE) throw std::invalid_argument("expression: в выражении нет ни одного массива");
+    return n;
+}
+
+// Вычисление выражения в out[0..size) одним проходом
+template <typename T, typename E>
+void evaluate(const Expr<E>& expr, T* out) {
+    const E e = expr.self();                         // Копия в каждом потоке (firstprivate): запись в out не может
+                                                     // изменить листья, поэтому указатели и числа остаются в регистрах
+    std::size_t n = expressionSize(expr);
+    #pragma omp parallel for simd schedule(static) firstprivate(e) if (n >= EXPRESSION_SEQUENTIAL_CUTOFF)
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = static_cast<T>(e[i]);
+    }
+}
+
+// Вычисление в vector (размер подгоняется под выражение)
+template <typename T, typename E>
+void evaluate(const Expr<E>& expr, std::vector<T>& out) {
+    out.resize(expressionSize(expr));
+    evaluate(expr, out.data());
+}
+
+// Новый массив со значениями выражения
+template <typename E>
+std::vector<typename E::value_type> toVector(const Expr<E>& expr) {
+    std::vector<typename E::value_type> out;
+    evaluate(expr, out);
+    return out;
+}
+
+// Сумма значений выражения (целые — в 64 бита, дробные — в double, как parallelSum)
+template <typename E>
+SumType<typename E::value_type> sumOf(const Expr<E>& expr) {
+    const E e = expr.self();
+    std::size_t n = expressionSize(expr);
+    SumType<typename E::value_type> sum = 0;
+    #pragma omp parallel for simd schedule(static) firstprivate(e) reduction(+ : sum) if (n >= EXPRESSION_SEQUENTIAL_CUTOFF)
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += e[i];
+    }
+    return sum;
+}
+
+// Минимум значений выражения (для пустого — numeric_limits::max())
+template <typename E>
+typename E::value_type minOf(const Expr<E>& expr) {
+    const E e = expr.self();
+    std::size_t n = expressionSize(expr);
+    typename E::value_type result = std::numeric_limits<typename E::value_type>::max();
+    #pragma omp parallel for simd schedule(static) firstprivate(e) reduction(min : result) if (n >= EXPRESSION_SEQUENTIAL_CUTOFF)
+    for (std::size_t i = 0; i < n; ++i) {
+        typename E::value_type v = e[i];
+        result = v < result ? v : result;
+    }
+    return result;
+}
+
+// Максимум значений выражения (для пустого — numeric_limits::lowest())
+template <typename E>
+typename E::value_type maxOf(const Expr<E>& expr) {
+    const E e = expr.self();
+    std::size_t n = expressionSize(expr);
+    typename E::value_type result = std::numeric_limits<typename E::value_type>::lowest();
+    #pragma omp parallel for simd schedule(static) firstprivate(e) reduction(max : result) if (n >= EXPRESSION_SEQUENTIAL_CUTOFF)
+    for (std::size_t i = 0; i < n; ++i) {
+        typename E::value_type v = e[i];
+        result = result < v ? v : result;
+    }
+    return result;
+}
+
+// Количество элементов, для которых условие истинно
+template <typename E>
+std::size_t countOf(const Expr<E>& cond) {
+    const E e = cond.self();
+    std::size_t n = expressionSize(cond);
+    std::size_t count = 0;
+    #pragma omp parallel for simd schedule(static) firstprivate(e) reduction(+ : count) if (n >= EXPRESSION_SEQUENTIAL_CUTOFF)
+    for (std::size_t i = 0; i < n; ++i) {
+        count += e[i] ? 1 : 0;
+    }
+    return count;
+}
@@ -0,0 +1,359 @@
+// Общая библиотека: внешняя сортировка слиянием двоичного файла целых чисел, который не помещается в память
+// Все сортировки библиотеки работают с массивом в памяти (vector<int>), поэтому размер данных ограничен RAM. Здесь файл
+// из подряд записанных значений T (int32 / int64, порядок байт машины) сортируется в пределах заданного бюджета памяти:
+//   - формирование серий: файл читается кусками по бюджету / 3 (два буфера чтения и временный буфер сортировки),
+//     кусок сортируется параллельно (radixSortParallel для 32-битных целых, parallelSampleSort для остальных)
+//     и пишется во временный файл на то же место; чтение следующего куска идёт в фоне, пока текущий сортируется и пишется;
+//   - слияние: у каждой серии окно в памяти и заранее читаемый блок (pread в фоновой задаче, двойная буферизация).
+//     За раунд из всех окон берутся элементы не больше наименьшего последнего элемента окон недочитанных серий —
+//     всё, что ещё в файле, не меньше его; эти префиксы сливаются parallelKWayMerge (merge_path.h) и выход пишется
+//     в фоне, пока сливается следующий раунд. Блок ввода-вывода — бюджет / (7 * число серий), не меньше
+//     EXTERNAL_MIN_BLOCK; если серий слишком много для такого блока, слияние идёт в несколько проходов
+//     (группы по fanIn серий, временные файлы чередуются);
+//   - файлы читаются и пишутся блоками от 1 МБ (pread / pwrite, posix_fadvise(SEQUENTIAL) для упреждающего чтения ОС).
+// Ошибки ввода-вывода — std::system_error с именем файла, неверный размер файла или бюджет — std::invalid_argument.
+// Только POSIX (Linux, macOS).
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <cstdint>       // Для uint64_t
+#include <cstdio>        // Для remove
+#include <cerrno>        // Для errno
+#include <string>        // Для путей
+#include <vector>        // Для списков серий
+#include <memory>        // Для unique_ptr
+#include <future>        // Для async / future (фоновый ввод-вывод)
+#include <chrono>        // Для steady_clock
+#include <cstring>       // Для memcpy / memmove
+#include <algorithm>     // Для upper_bound / min
+#include <stdexcept>     // Для invalid_argument
+#include <system_error>  // Для system_error
+#include <type_traits>   // Для is_integral / is_trivially_copyable
+#include <fcntl.h>       // Для open / posix_fadvise
+#include <unistd.h>      // Для pread / pwrite / close / getpid
+#include <sys/stat.h>    // Для fstat
+#include "page_buffer.h" // Для PageBuffer (буферы без инициализации)
+#include "arena.h"       // Для scratchArena (временный буфер сортировки серии)
+#include "radix_sort.h"  // Для radixSortParallel
+#include "parallel_sort.h"   // Для parallelSampleSort
+#include "merge_path.h"      // Для parallelKWayMerge / SortedRun
+
+const std::size_t EXTERNAL_DEFAULT_MEMORY = 256 << 20;   // Бюджет памяти по умолчанию
+const std::size_t EXTERNAL_MIN_BLOCK = 1 << 20;          // Наименьший блок чтения при слиянии (меньше — ещё один проход)
+const std::size_t EXTERNAL_MAX_BLOCK = 16 << 20;         // Больший блок не ускоряет последовательное чтение
+const std::size_t EXTERNAL_MERGE_BLOCKS = 7;             // Блоков памяти на серию при слиянии: окно 2, упреждение 1, выход 2 x 2
+const std::size_t EXTERNAL_RUN_BUFFERS = 3;              // Буферов серии при формировании: чтение 2, сортировка 1
+
+// Файл для чтения и записи по смещению; pread / pwrite можно вызывать из нескольких потоков одновременно
+class BinaryFile {
+public:
+    enum class Mode {
+        Read,         // Существующий файл
+        Write         // Создать или обрезать
+    };
+
+    BinaryFile(const std::string& path, Mode mode) : path_(path) {
+        fd_ = mode == Mode::Read ? ::open(path.c_str(), O_RDONLY) : ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd_ < 0) fail("open");
+#ifdef POSIX_FADV_SEQUENTIAL
+        if (mode == Mode::Read) posix_fadvise(fd_, 0, 0, POSIX_FADV_SEQUENTIAL);    // Окно упреждающего чтения шире
+#endif
+    }
+
+    ~BinaryFile() {
+        if (fd_ >= 0) ::close(fd_);
+    }
+
+    BinaryFile(const BinaryFile&) = delete;
+    BinaryFile& operator=(const BinaryFile&) = delete;
+
+    const std::string& path() const { return path_; }
+
+    std::uint64_t size() const {
+        struct stat info;
+        if (fstat(fd_, &info) != 0) fail("fstat");
+        return static_cast<std::uint64_t>(info.st_size);
+    }
+
+    // Ровно bytes байт со смещения offset (короткое чтение — продолжение, конец файла раньше — ошибка)
+    void read(void* data, std::size_t bytes, std::uint64_t offset) const {
+        char* p = static_cast<char*>(data);
+        while (bytes > 0) {
+            ssize_t done = ::pread(fd_, p, bytes, static_cast<off_t>(offset));
+            if (done < 0 && errno == EINTR) continue;
+            if (done < 0) fail("pread");
+            if (done == 0) {
+                errno = EIO;
+                fail("pread: неожиданный конец файла");
+            }
+            p += done;
+            bytes -= static_cast<std::size_t>(done);
+            offset += static_cast<std::uint64_t>(done);
+        }
+    }
+
+    void write(const void* data, std::size_t bytes, std::uint64_t offset) const {
+        const char* p = static_cast<const char*>(data);
+        while (bytes > 0) {
+            ssize_t done = ::pwrite(fd_, p, bytes, static_cast<off_t>(offset));
+            if (done < 0 && errno == EINTR) continue;
+            if (done < 0) fail("pwrite");
+            p += done;
+            bytes -= static_cast<std::size_t>(done);
+            offset += static_cast<std::uint64_t>(done);
+        }
+    }
+
+private:
+    [[noreturn]] void fail(const char* what) const {
+        throw std::system_error(errno, std::generic_category(), std::string(what) + " " + path_);
+    }
+
+    std::string path_;
+    int fd_ = -1;
+};
+
+// Временный файл: удаляется при разрушении
+class TempFile {
+public:
+    TempFile(const std::string& dir, const std::string& tag) {
+        static int counter = 0;
+        path_ = (dir.empty() ? std::string(".") : dir) + "/external_sort_" + std::to_string(getpid()) + "_"
+              + std::to_string(counter++) + "_" + tag + ".tmp";
+    }
+    ~TempFile() { std::remove(path_.c_str()); }
+
+    TempFile(const TempFile&) = delete;
+    TempFile& operator=(const TempFile&) = delete;
+
+    const std::string& path() const { return path_; }
+
+private:
+    std::string path_;
+};
+
+// Серия в файле: элементы [offset, offset + count)
+struct ExternalRun {
+    std::uint64_t offset = 0;
+    std::uint64_t count = 0;
+};
+
+// Параметры сортировки
+struct ExternalSortOptions {
+    std::size_t memoryBytes = EXTERNAL_DEFAULT_MEMORY;   // Бюджет памяти на буферы серий и слияния
+    std::string tempDir = ".";                           // Каталог временных файлов (место — до двух размеров входа)
+};
+
+// Что сделала сортировка
+struct ExternalSortStats {
+    std::uint64_t elements = 0;
+    std::size_t runs = 0;              // Серий после первой фазы
+    std::size_t runElements = 0;       // Элементов в серии (кроме последней)
+    std::size_t mergePasses = 0;       // Проходов слияния (0 — одна серия)
+    std::size_t fanIn = 0;             // Серий, сливаемых за раз
+    std::size_t blockElements = 0;     // Блок чтения в последнем проходе слияния
+    double runSeconds = 0;             // Формирование серий
+    double mergeSeconds = 0;           // Все проходы слияния
+};
+
+// Параллельная сортировка куска в памяти
+template <typename T>
+void sortExternalRun(T* data, std::size_t n) {
+    if constexpr (std::is_integral<T>::value && sizeof(T) == 4) radixSortParallel(data, n);
+    else parallelSampleSort(data, n);
+}
+
+// Чтение одной серии при слиянии: окно [head, tail) в памяти и следующий блок, который читается в фоне
+template <typename T>
+class ExternalRunReader {
+public:
+    ExternalRunReader(const BinaryFile& file, const ExternalRun& run, std::size_t block)
+        : file_(&file), next_(run.offset), end_(run.offset + run.count), block_(block),
+          window_(2 * block * sizeof(T), PageMode::Default), prefetch_(block * sizeof(T), PageMode::Default) {
+        request();
+    }
+
+    ExternalRunReader(const ExternalRunReader&) = delete;
+    ExternalRunReader& operator=(const ExternalRunReader&) = delete;
+
+    // Если в окне меньше блока — остаток переносится в начало и дописывается прочитанный заранее блок
+    void refill() {
+        if (size() >= block_ || !pending_.valid()) return;
+        T* window = window_.as<T>();
+        std::memmove(window, window + head_, size() * sizeof(T));
+        tail_ -= head_;
+        head_ = 0;
+        pending_.get();                              // Ошибка чтения выбрасывается здесь
+        std::memcpy(window + tail_, prefetch_.as<T>(), pendingCount_ * sizeof(T));
+        tail_ += pendingCount_;
+        request();
+    }
+
+    bool complete() const { return !pending_.valid(); }     // В окне весь остаток серии
+    const T* begin() const { return window_.as<T>() + head_; }
+    const T* end() const { return window_.as<T>() + tail_; }
+    std::size_t size() const { return tail_ - head_; }
+    void consume(std::size_t count) { head_ += count; }
+
+private:
+    void request() {
+        if (next_ == end_) return;
+        std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(block_, end_ - next_));
+        const BinaryFile* file = file_;
+        T* target = prefetch_.as<T>();
+        std::uint64_t offset = next_ * sizeof(T);
+        pending_ = std::async(std::launch::async, [file, target, count, offset] { file->read(target, count * sizeof(T), offset); });
+        pendingCount_ = count;
+        next_ += count;
+    }
+
+    const BinaryFile* file_;
+    std::uint64_t next_;               // Первый элемент, который ещё не запрошен
+    std::uint64_t end_;
+    std::size_t block_;
+    PageBuffer window_;                // 2 блока
+    PageBuffer prefetch_;              // 1 блок
+    std::size_t head_ = 0;
+    std::size_t tail_ = 0;
+    std::size_t pendingCount_ = 0;
+    std::future<void> pending_;        // Последним: при разрушении ждёт чтения, пока буферы живы
+};
+
+// Слияние серий group файла source в одну серию target на том же месте; block — элементов в блоке чтения
+template <typename T>
+void mergeExternalRuns(const BinaryFile& source, const std::vector<ExternalRun>& group, const BinaryFile& target,
+                       std::size_t block) {
+    std::size_t k = group.size();
+    std::vector<std::unique_ptr<ExternalRunReader<T>>> readers;
+    for (const ExternalRun& run : group) readers.emplace_back(new ExternalRunReader<T>(source, run, block));
+    std::size_t outCapacity = 2 * block * k;         // Раунд выдаёт не больше, чем лежит во всех окнах
+    PageBuffer out[2] = {PageBuffer(outCapacity * sizeof(T), PageMode::Default),
+                         PageBuffer(outCapacity * sizeof(T), PageMode::Default)};
+    std::vector<SortedRun<T>> parts(k);
+    std::uint64_t written = group.empty() ? 0 : group.front().offset;
+    int current = 0;
+    std::future<void> writing;                       // После буферов: при исключении ждёт записи, пока они живы
+
+    while (true) {
+        for (auto& reader : readers) reader->refill();
+
+        // Граница раунда: всё, что ещё в файле, не меньше последнего элемента окна своей серии
+        bool bounded = false;
+        T bound = T();
+        for (auto& reader : readers) {
+            if (reader->complete()) continue;
+            T last = reader->end()[-1];
+            if (!bounded || last < bound) bound = last;
+            bounded = true;
+        }
+
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < k; ++i) {
+            parts[i].first = readers[i]->begin();
+            parts[i].last = bounded ? std::upper_bound(readers[i]->begin(), readers[i]->end(), bound) : readers[i]->end();
+            total += parts[i].size();
+        }
+        if (total == 0) break;                       // Все серии исчерпаны
+
+        T* dst = out[current].as<T>();
+        parallelKWayMerge(parts, dst);
+        for (std::size_t i = 0; i < k; ++i) readers[i]->consume(parts[i].size());
+
+        if (writing.valid()) writing.get();          // Предыдущий раунд записан — его буфер снова свободен
+        const BinaryFile* file = &target;
+        std::uint64_t offset = written * sizeof(T);
+        writing = std::async(std::launch::async, [file, dst, total, offset] { file->write(dst, total * sizeof(T), offset); });
+        written += total;
+        current ^= 1;
+    }
+    if (writing.valid()) writing.get();
+}
+
+// Внешняя сортировка файла inputPath в outputPath (файлы разные)
+template <typename T>
+ExternalSortStats externalSort(const std::string& inputPath, const std::string& outputPath,
+                               const ExternalSortOptions& options = ExternalSortOptions()) {
+    static_assert(std::is_trivially_copyable<T>::value, "externalSort: элементы читаются из файла побайтно");
+    if (inputPath == outputPath) throw std::invalid_argument("externalSort: результат нельзя писать во входной файл");
+    ExternalSortStats stats;
+    BinaryFile input(inputPath, BinaryFile::Mode::Read);
+    std::uint64_t bytes = input.size();
+    if (bytes % sizeof(T) != 0) throw std::invalid_argument("externalSort: размер файла не кратен размеру элемента");
+    std::uint64_t n = bytes / sizeof(T);
+    std::size_t maxFanIn = options.memoryBytes / (EXTERNAL_MERGE_BLOCKS * EXTERNAL_MIN_BLOCK);
+    if (maxFanIn < 2) throw std::invalid_argument("externalSort: бюджет памяти меньше 2 * 7 блоков по 1 МБ");
+    std::size_t runElements = options.memoryBytes / (EXTERNAL_RUN_BUFFERS * sizeof(T));
+    stats.elements = n;
+    stats.runElements = runElements;
+
+    BinaryFile output(outputPath, BinaryFile::Mode::Write);
+    std::size_t runCount = static_cast<std::size_t>((n + runElements - 1) / runElements);
+    TempFile tempA(options.tempDir, "a"), tempB(options.tempDir, "b");
+    std::unique_ptr<BinaryFile> runsFile(runCount > 1 ? new BinaryFile(tempA.path(), BinaryFile::Mode::Write) : nullptr);
+    const BinaryFile& runTarget = runsFile ? *runsFile : output;   // Одна серия — сразу в результат
+
+    // 1. Серии: чтение куска r + 1 в фоне, пока кусок r сортируется и пишется
+    auto start = std::chrono::steady_clock::now();
+    std::vector<ExternalRun> runs;
+    {
+        std::size_t bufferElements = static_cast<std::size_t>(std::min<std::uint64_t>(runElements, n));
+        PageBuffer buffers[2] = {PageBuffer(bufferElements * sizeof(T), PageMode::Default),
+                                 PageBuffer(bufferElements * sizeof(T), PageMode::Default)};
+        auto readRun = [&input, &buffers, runElements, n](std::size_t r) {
+            std::uint64_t offset = static_cast<std::uint64_t>(r) * runElements;
+            std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(runElements, n - offset));
+            T* target = buffers[r % 2].template as<T>();
+            const BinaryFile* file = &input;
+            return std::async(std::launch::async, [file, target, count, offset] { file->read(target, count * sizeof(T), offset * sizeof(T)); });
+        };
+        std::future<void> reading;                   // После буферов: при исключении ждёт чтения, пока они живы
+        if (runCount > 0) reading = readRun(0);
+        for (std::size_t r = 0; r < runCount; ++r) {
+            reading.get();
+            if (r + 1 < runCount) reading = readRun(r + 1);
+            ExternalRun run;
+            run.offset = static_cast<std::uint64_t>(r) * runElements;
+            run.count = std::min<std::uint64_t>(runElements, n - run.offset);
+            T* data = buffers[r % 2].template as<T>();
+            sortExternalRun(data, static_cast<std::size_t>(run.count));
+            runTarget.write(data, static_cast<std::size_t>(run.count) * sizeof(T), run.offset * sizeof(T));
+            runs.push_back(run);
+        }
+    }
+    scratchArena().release();                        // Временный буфер сортировки серии не нужен при слиянии
+    stats.runs = runs.size();
+    stats.runSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // 2. Проходы слияния: группы по fanIn серий; последний проход пишет в результат
+    start = std::chrono::steady_clock::now();
+    std::unique_ptr<BinaryFile> source = std::move(runsFile);
+    bool sourceIsA = true;
+    while (runs.size() > 1) {
+        std::size_t fanIn = std::min(runs.size(), maxFanIn);
+        bool last = runs.size() <= maxFanIn;
+        std::unique_ptr<BinaryFile> next(last ? nullptr
+                                              : new BinaryFile(sourceIsA ? tempB.path() : tempA.path(), BinaryFile::Mode::Write));
+        const BinaryFile& target = last ? output : *next;
+        std::size_t block = options.memoryBytes / (EXTERNAL_MERGE_BLOCKS * fanIn * sizeof(T));
+        block = std::min(block, EXTERNAL_MAX_BLOCK / sizeof(T));
+
+        std::vector<ExternalRun> merged;
+        for (std::size_t first = 0; first < runs.size(); first += fanIn) {
+            std::vector<ExternalRun> group(runs.begin() + first, runs.begin() + std::min(first + fanIn, runs.size()));
+            mergeExternalRuns<T>(*source, group, target, block);
+            ExternalRun run;
+            run.offset = group.front().offset;       // Серии лежат подряд — слияние занимает их место
+            for (const ExternalRun& part : group) run.count += part.count;
+            merged.push_back(run);
+        }
+        runs.swap(merged);
+        source = std::move(next);
+        sourceIsA = !sourceIsA;
+        stats.fanIn = fanIn;
+        stats.blockElements = block;
+        ++stats.mergePasses;
+    }
+    stats.mergeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
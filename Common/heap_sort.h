@@ -0,0 +1,200 @@
+// Общая библиотека: параллельное построение кучи, пирамидальная сортировка и частичная сортировка (top-k)
+// gpuHeapSortKernel (Practice3task4) запускался <<<1,1>>> и делал по одному шагу просеивания на узел, поэтому не строил
+// кучу и не сортировал; heapSortKernel (Practice3task3) сортировал куски без слияния. Здесь:
+//   - parallelMakeHeap — куча (максимум в корне, как std::make_heap) по уровням снизу вверх: просеивания узлов одного
+//     уровня затрагивают непересекающиеся поддеревья, поэтому уровень делится между потоками (omp for);
+//     верхние уровни с малым числом узлов выполняет один поток;
+//   - parallelHeapSort — каждый поток сортирует свой кусок пирамидальной сортировкой, куски сливаются
+//     parallelKWayMerge (merge_path.h) — извлечение из одной кучи последовательно по своей природе;
+//   - parallelTopK — k наименьших элементов по возрастанию: у каждого потока своя ограниченная куча из k элементов,
+//     затем кандидаты всех потоков сортируются частично;
+//   - parallelPartialSort — как std::partial_sort: в начале массива k наименьших по возрастанию, остальные — после.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <vector>        // Для куч потоков и буферов
+#include <algorithm>     // Для push_heap / pop_heap / partial_sort / copy
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"   // Для threadRange
+#include "merge_path.h"  // Для parallelKWayMerge / SortedRun
+#include "arena.h"       // Для ScratchArray
+
+const std::size_t HEAP_PARALLEL_CUTOFF = 1 << 15;      // Меньшие массивы обрабатывает один поток
+const std::size_t HEAP_LEVEL_PARALLEL_MIN = 1 << 10;   // Уровни кучи с меньшим числом узлов — в одном потоке
+
+// Просеивание вниз узла i кучи a[0..n) (максимум в корне)
+template <typename T>
+void heapSiftDown(T* a, std::size_t n, std::size_t i) {
+    T value = a[i];                                  // Просеиваемый элемент; на его месте "дырка"
+    while (true) {
+        std::size_t child = 2 * i + 1;
+        if (child >= n) break;
+        if (child + 1 < n && a[child] < a[child + 1]) ++child;        // Больший из потомков
+        if (!(value < a[child])) break;
+        a[i] = a[child];
+        i = child;
+    }
+    a[i] = value;
+}
+
+// Последовательная пирамидальная сортировка a[0..n) по возрастанию
+template <typename T>
+void heapSortRange(T* a, std::size_t n) {
+    for (std::size_t i = n / 2; i-- > 0;) heapSiftDown(a, n, i);
+    for (std::size_t end = n; end > 1; --end) {
+        std::swap(a[0], a[end - 1]);                 // Максимум — в конец
+        heapSiftDown(a, end - 1, 0);
+    }
+}
+
+// Параллельное построение кучи a[0..n) по уровням снизу вверх
+template <typename T>
+void parallelMakeHeap(T* a, std::size_t n) {
+    if (n < 2) return;
+    std::size_t internal = n / 2;                    // Узлы [0, internal) имеют потомков
+    int top = 0;                                     // Номер уровня последнего внутреннего узла
+    while ((std::size_t(2) << top) - 1 < internal) ++top;
+
+    #pragma omp parallel if (n >= HEAP_PARALLEL_CUTOFF)
+    {
+        for (int level = top; level >= 0; --level) {
+            std::size_t first = (std::size_t(1) << level) - 1;       // Узлы уровня: [first, last)
+            std::size_t last = (std::size_t(2) << level) - 1;
+            if (last > internal) last = internal;
+            if (last - first >= HEAP_LEVEL_PARALLEL_MIN) {
+                #pragma omp for schedule(static)     // Неявный барьер: следующий уровень видит готовые поддеревья
+                for (std::size_t i = first; i < last; ++i) heapSiftDown(a, n, i);
+            } else {
+                #pragma omp single                   // Неявный барьер после single
+                for (std::size_t i = first; i < last; ++i) heapSiftDown(a, n, i);
+            }
+        }
+    }
+}
+
+// Параллельная пирамидальная сортировка: куски потоков — heapSortRange, затем k-путевое слияние
+template <typename T>
+void parallelHeapSort(T* data, std::size_t n) {
+    int parts = omp_get_max_threads();
+    if (parts == 1 || n < HEAP_PARALLEL_CUTOFF) {
+        heapSortRange(data, n);
+        return;
+    }
+    std::vector<std::size_t> offsets(parts + 1);
+    for (int t = 0; t < parts; ++t) {
+        std::size_t end;
+        threadRange(n, t, parts, offsets[t], end);
+    }
+    offsets[parts] = n;
+
+    #pragma omp parallel for schedule(static, 1)
+    for (int t = 0; t < parts; ++t) heapSortRange(data + offsets[t], offsets[t + 1] - offsets[t]);
+
+    ScratchArray<T> merged(n);                       // Буфер слияния (из арены потока, без обнуления)
+    parallelKWayMerge(runsFromOffsets(static_cast<const T*>(data), offsets), merged.data());
+    const T* result = merged.data();
+    #pragma omp parallel for schedule(static, 1)     // Обратно теми же кусками
+    for (int t = 0; t < parts; ++t) std::copy(result + offsets[t], result + offsets[t + 1], data + offsets[t]);
+}
+
+// k наименьших элементов data[0..n) по возрастанию (k > n — все элементы)
+template <typename T>
+std::vector<T> parallelTopK(const T* data, std::size_t n, std::size_t k) {
+    if (k > n) k = n;
+    if (k == 0) return std::vector<T>();
+    std::vector<std::vector<T>> heaps;               // Кучи потоков: максимум из k лучших — в корне
+
+    #pragma omp parallel if (n >= HEAP_PARALLEL_CUTOFF)
+    {
+        int tid = omp_get_thread_num();
+        int nthreads = omp_get_num_threads();
+        #pragma omp single
+        heaps.resize(nthreads);                      // Неявный барьер после single
+
+        std::vector<T>& heap = heaps[tid];
+        heap.reserve(k);
+        std::size_t begin, end;
+        threadRange(n, tid, nthreads, begin, end);
+        for (std::size_t i = begin; i < end; ++i) {
+            if (heap.size() < k) {
+                heap.push_back(data[i]);
+                std::push_heap(heap.begin(), heap.end());
+            } else if (data[i] < heap.front()) {     // Меньше худшего из лучших — заменяет его
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = data[i];
+                std::push_heap(heap.begin(), heap.end());
+            }
+        }
+    }
+
+    std::vector<T> candidates;                       // Не больше k кандидатов от каждого потока
+    for (const std::vector<T>& heap : heaps) candidates.insert(candidates.end(), heap.begin(), heap.end());
+    std::partial_sort(candidates.begin(), candidates.begin() + k, candidates.end());
+    candidates.resize(k);
+    return candidates;
+}
+
+// Частичная сортировка: data[0..k) — k наименьших по возрастанию, data[k..n) — остальные элементы (порядок не задан)
+template <typename T>
+void parallelPartialSort(T* data, std::size_t n, std::size_t k) {
+    if (k > n) k = n;
+    if (k == 0) return;
+    std::vector<T> best = parallelTopK(data, n, k);
+    T kth = best.back();                             // k-й наименьший
+    std::size_t lessInBest = std::lower_bound(best.begin(), best.end(), kth) - best.begin();
+    std::size_t equalNeeded = k - lessInBest;        // Сколько элементов, равных kth, уходит в начало
+
+    // Остальные элементы (больше kth и "лишние" равные kth) в порядке индексов — в буфер rest
+    std::vector<T> rest(n - k);
+    std::vector<std::size_t> lessCount, equalCount;  // По кускам потоков
+
+    #pragma omp parallel if (n >= HEAP_PARALLEL_CUTOFF)
+    {
+        int tid = omp_get_thread_num();
+        int nthreads = omp_get_num_threads();
+        #pragma omp single
+        {
+            lessCount.assign(nthreads, 0);
+            equalCount.assign(nthreads, 0);
+        }
+        std::size_t begin, end;
+        threadRange(n, tid, nthreads, begin, end);
+        for (std::size_t i = begin; i < end; ++i) {
+            if (data[i] < kth) ++lessCount[tid];
+            else if (!(kth < data[i])) ++equalCount[tid];
+        }
+        #pragma omp barrier
+
+        std::size_t equalBefore = 0, restBefore = 0; // Равные kth и "остальные" в кусках левее
+        for (int t = 0; t < tid; ++t) {
+            std::size_t tb, te;
+            threadRange(n, t, nthreads, tb, te);
+            std::size_t taken = equalBefore >= equalNeeded ? 0 : std::min(equalCount[t], equalNeeded - equalBefore);
+            restBefore += (te - tb) - lessCount[t] - taken;
+            equalBefore += equalCount[t];
+        }
+        for (std::size_t i = begin; i < end; ++i) {
+            if (data[i] < kth) continue;
+            if (!(kth < data[i]) && equalBefore++ < equalNeeded) continue;   // Равный kth уходит в начало
+            rest[restBefore++] = data[i];
+        }
+        #pragma omp barrier
+
+        #pragma omp for schedule(static)
+        for (std::size_t i = 0; i < n; ++i) data[i] = i < k ? best[i] : rest[i - k];
+    }
+}
+
+// Перегрузки для vector
+template <typename T>
+void parallelMakeHeap(std::vector<T>& v) { parallelMakeHeap(v.data(), v.size()); }
+
+template <typename T>
+void parallelHeapSort(std::vector<T>& v) { parallelHeapSort(v.data(), v.size()); }
+
+template <typename T>
+std::vector<T> parallelTopK(const std::vector<T>& v, std::size_t k) { return parallelTopK(v.data(), v.size(), k); }
+
+template <typename T>
+void parallelPartialSort(std::vector<T>& v, std::size_t k) { parallelPartialSort(v.data(), v.size(), k); }
@@ -0,0 +1,93 @@
+// Общая библиотека: иерархическая редукция без общей горячей точки
+// sumKernel (Assignment_4) и reduction_global (Practice4) делают atomicAdd в один d_result на каждый элемент,
+// а первая версия assignment1_task2 пропускала потоки через omp critical — все потоки ждут одну кэш-линию.
+// Здесь три уровня, и ни на одном нет общей переменной, в которую пишут все потоки:
+//   1) поток — свой непрерывный кусок, SIMD-аккумуляторы (reduceRange из reduction.h или sumRange), сумма в 64 бита;
+//   2) узел NUMA — первый поток каждого узла сворачивает частичные результаты потоков своего узла
+//      (читает память своего узла; узлы работают параллельно);
+//   3) итог — главный поток сворачивает по одному результату на узел.
+// На машине с одним узлом уровень 2 — один проход по p частичным результатам, как в parallelReduce.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <vector>        // Для частичных результатов
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"   // Для reduceRange / mergeReduction / threadRange
+#include "topology.h"    // Для узлов NUMA
+
+// Частичный результат уровня 1 или 2, выровнен по кэш-линии
+template <typename R>
+struct alignas(CACHE_LINE_SIZE) HierarchicalPartial {
+    R value;
+};
+
+// Общая схема: local(begin, end) — результат куска потока, merge(into, from) — объединение результатов
+template <typename R, typename Local, typename Merge>
+R hierarchicalCombine(std::size_t n, Local local, Merge merge) {
+    int maxThreads = omp_get_max_threads();
+    int nodes = numaNodeCount();
+    std::vector<HierarchicalPartial<R>> threadPartials(maxThreads);   // Уровень 1: по кэш-линии на поток
+    std::vector<HierarchicalPartial<R>> nodePartials(nodes);          // Уровень 2: по кэш-линии на узел
+    std::vector<int> threadNode(maxThreads, 0);                       // Узел каждого потока
+
+    #pragma omp parallel
+    {
+        int tid = omp_get_thread_num();
+        int nthreads = omp_get_num_threads();
+        std::size_t begin, end;
+        threadRange(n, tid, nthreads, begin, end);
+        threadPartials[tid].value = local(begin, end);
+        threadNode[tid] = currentNumaNode();                           // Узел, на котором поток читал свой кусок
+        #pragma omp barrier
+
+        int node = threadNode[tid];
+        bool leader = true;                                            // Первый поток своего узла
+        for (int t = 0; t < tid && leader; ++t) leader = threadNode[t] != node;
+        if (leader) {
+            for (int t = tid; t < nthreads; ++t) {
+                if (threadNode[t] == node) merge(nodePartials[node].value, threadPartials[t].value);
+            }
+        }
+    }
+
+    R result = R();
+    for (int node = 0; node < nodes; ++node) merge(result, nodePartials[node].value);
+    return result;
+}
+
+// Сумма куска [begin, end) в широком типе (SIMD-редукция)
+template <typename T>
+SumType<T> sumRange(const T* data, std::size_t begin, std::size_t end) {
+    SumType<T> sum = 0;
+    #pragma omp simd reduction(+:sum)
+    for (std::size_t i = begin; i < end; ++i) sum += data[i];
+    return sum;
+}
+
+// Иерархическая редукция: min, max, 64-битная сумма и количество
+template <typename T>
+ReductionResult<T> hierarchicalReduce(const T* data, std::size_t n, std::size_t sequentialCutoff = REDUCTION_SEQUENTIAL_CUTOFF) {
+    static_assert(std::is_arithmetic<T>::value, "hierarchicalReduce: нужен арифметический тип");
+    if (n < sequentialCutoff) return reduceRange(data, 0, n);
+    return hierarchicalCombine<ReductionResult<T>>(
+        n, [data](std::size_t b, std::size_t e) { return reduceRange(data, b, e); },
+        [](ReductionResult<T>& into, const ReductionResult<T>& from) { mergeReduction(into, from); });
+}
+
+// Иерархическая сумма (64-битная для целых): на уровне 1 только сумма, без min / max
+template <typename T>
+SumType<T> hierarchicalSum(const T* data, std::size_t n, std::size_t sequentialCutoff = REDUCTION_SEQUENTIAL_CUTOFF) {
+    static_assert(std::is_arithmetic<T>::value, "hierarchicalSum: нужен арифметический тип");
+    if (n < sequentialCutoff) return sumRange(data, 0, n);
+    return hierarchicalCombine<SumType<T>>(
+        n, [data](std::size_t b, std::size_t e) { return sumRange(data, b, e); },
+        [](SumType<T>& into, const SumType<T>& from) { into += from; });
+}
+
+// Перегрузки для vector
+template <typename T>
+ReductionResult<T> hierarchicalReduce(const std::vector<T>& v) { return hierarchicalReduce(v.data(), v.size()); }
+
+template <typename T>
+SumType<T> hierarchicalSum(const std::vector<T>& v) { return hierarchicalSum(v.data(), v.size()); }
@@ -0,0 +1,115 @@
+// Общая библиотека: ограниченная lock-free очередь MPMC (много производителей, много потребителей)
+// struct Queue из Practice5_Part2 двигает head / tail через atomicAdd, но dequeue читает tail без синхронизации,
+// после переполнения индексы уходят за границу и очередь больше не используется, а при гонке возвращаются нули.
+// Здесь — кольцевой буфер Д. Вьюкова:
+//   - у каждой ячейки свой номер последовательности: он говорит, чья сейчас очередь — записывать или читать;
+//   - производитель занимает позицию CAS на enqueuePos, потребитель — CAS на dequeuePos; ячейку после этого
+//     трогает только владелец позиции, и номер последовательности публикует данные (release / acquire);
+//   - позиции растут бесконечно, ячейка — pos & mask, поэтому после заполнения и опустошения очередь
+//     продолжает работать;
+//   - tryPush / tryPop не блокируются: полная или пустая очередь — false;
+//   - позиции и ячейки лежат в отдельных кэш-линиях (производители и потребители не мешают друг другу).
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <cstdint>       // Для intptr_t
+#include <atomic>        // Для atomic
+#include <memory>        // Для unique_ptr
+#include <thread>        // Для yield
+#include <utility>       // Для move / forward
+#include "reduction.h"   // Для CACHE_LINE_SIZE
+
+template <typename T>
+class BoundedMpmcQueue {
+public:
+    // Ёмкость округляется вверх до степени двойки (не меньше 2)
+    explicit BoundedMpmcQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) size *= 2;
+        mask_ = size - 1;
+        cells_.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+        enqueuePos_.store(0, std::memory_order_relaxed);
+        dequeuePos_.store(0, std::memory_order_relaxed);
+    }
+
+    BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+    BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+    // Добавление; false — очередь полна
+    bool tryPush(const T& value) { return emplace(value); }
+    bool tryPush(T&& value) { return emplace(std::move(value)); }
+
+    // Извлечение в порядке добавления; false — очередь пуста
+    bool tryPop(T& value) {
+        std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {                                           // Ячейка заполнена для этой позиции
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;                                          // Производитель ещё не записал — пусто
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);     // Позицию занял другой потребитель
+            }
+        }
+        value = std::move(cell->data);
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release); // Ячейка свободна для следующего круга
+        return true;
+    }
+
+    // Блокирующие варианты: ждут места / элемента, уступая процессор
+    template <typename U>
+    void push(U&& value) {
+        while (!tryPush(std::forward<U>(value))) std::this_thread::yield();
+    }
+
+    void pop(T& value) {
+        while (!tryPop(value)) std::this_thread::yield();
+    }
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+    // Приблизительный размер (точный только без одновременных операций)
+    std::size_t sizeApprox() const {
+        std::size_t tail = enqueuePos_.load(std::memory_order_relaxed);
+        std::size_t head = dequeuePos_.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+
+private:
+    struct alignas(CACHE_LINE_SIZE) Cell {
+        std::atomic<std::size_t> sequence;
+        T data;
+    };
+
+    template <typename U>
+    bool emplace(U&& value) {
+        std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {                                           // Ячейка свободна для этой позиции
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;                                          // Потребитель ещё не освободил — полна
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);     // Позицию занял другой производитель
+            }
+        }
+        cell->data = std::forward<U>(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);     // Публикация данных потребителю
+        return true;
+    }
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_ = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> enqueuePos_;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> dequeuePos_;
+};
@@ -0,0 +1,110 @@
+// Общая библиотека: ограниченный lock-free стек (стек Трайбера) с защитой от ABA
+// struct Stack из Practice5_Part1 двигает top через atomicAdd / atomicSub: pop может прочитать ячейку,
+// которую push ещё не записал, а после переполнения top остаётся за границей. Здесь:
+//   - узлы заранее выделены в пуле, свободные узлы — во втором стеке (free list), память не освобождается
+//     во время работы, поэтому нет обращений к удалённым узлам;
+//   - вершина стека — 64-битное слово: индекс узла (32 бита) и метка (32 бита), метка растёт при каждом
+//     успешном CAS. Если за время операции узел сняли и вернули (ABA), метка другая — CAS не проходит;
+//   - достаточно обычного 64-битного CAS, 128-битный (cmpxchg16b) не нужен;
+//   - tryPush / tryPop не блокируются: полный или пустой стек — false.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <cstdint>       // Для uint32_t / uint64_t
+#include <atomic>        // Для atomic
+#include <memory>        // Для unique_ptr
+#include <utility>       // Для move
+#include "reduction.h"   // Для CACHE_LINE_SIZE
+
+template <typename T>
+class LockFreeStack {
+public:
+    // capacity — наибольшее число элементов (меньше 2^32 - 1)
+    explicit LockFreeStack(std::size_t capacity) : capacity_(capacity) {
+        nodes_.reset(new Node[capacity]);
+        for (std::size_t i = 0; i < capacity; ++i) {                  // Все узлы — в списке свободных
+            nodes_[i].next.store(i + 1 < capacity ? static_cast<std::uint32_t>(i + 1) : NIL, std::memory_order_relaxed);
+        }
+        top_.store(pack(NIL, 0), std::memory_order_relaxed);
+        free_.store(pack(capacity ? 0 : NIL, 0), std::memory_order_relaxed);
+    }
+
+    LockFreeStack(const LockFreeStack&) = delete;
+    LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+    // Добавление; false — стек полон
+    bool tryPush(const T& value) {
+        std::uint32_t index;
+        if (!popNode(free_, index)) return false;
+        nodes_[index].value = value;
+        pushNode(top_, index);                                         // release публикует value
+        return true;
+    }
+
+    bool tryPush(T&& value) {
+        std::uint32_t index;
+        if (!popNode(free_, index)) return false;
+        nodes_[index].value = std::move(value);
+        pushNode(top_, index);
+        return true;
+    }
+
+    // Извлечение последнего добавленного; false — стек пуст
+    bool tryPop(T& value) {
+        std::uint32_t index;
+        if (!popNode(top_, index)) return false;
+        value = std::move(nodes_[index].value);
+        pushNode(free_, index);                                        // Узел снова свободен
+        return true;
+    }
+
+    std::size_t capacity() const { return capacity_; }
+
+private:
+    static constexpr std::uint32_t NIL = 0xFFFFFFFFu;                     // Пустой список
+
+    struct Node {
+        T value;
+        std::atomic<std::uint32_t> next;
+    };
+
+    static std::uint64_t pack(std::uint32_t index, std::uint32_t tag) {
+        return (static_cast<std::uint64_t>(tag) << 32) | index;
+    }
+    static std::uint32_t indexOf(std::uint64_t head) { return static_cast<std::uint32_t>(head); }
+    static std::uint32_t tagOf(std::uint64_t head) { return static_cast<std::uint32_t>(head >> 32); }
+
+    // Снятие узла с вершины списка head
+    bool popNode(std::atomic<std::uint64_t>& head, std::uint32_t& index) {
+        std::uint64_t old = head.load(std::memory_order_acquire);
+        while (true) {
+            std::uint32_t top = indexOf(old);
+            if (top == NIL) return false;
+            // next может оказаться устаревшим, если узел уже сняли, — тогда метка изменилась и CAS не пройдёт
+            std::uint32_t next = nodes_[top].next.load(std::memory_order_relaxed);
+            if (head.compare_exchange_weak(old, pack(next, tagOf(old) + 1),
+                                           std::memory_order_acquire, std::memory_order_acquire)) {
+                index = top;
+                return true;
+            }
+        }
+    }
+
+    // Добавление узла index на вершину списка head
+    void pushNode(std::atomic<std::uint64_t>& head, std::uint32_t index) {
+        std::uint64_t old = head.load(std::memory_order_relaxed);
+        while (true) {
+            nodes_[index].next.store(indexOf(old), std::memory_order_relaxed);
+            if (head.compare_exchange_weak(old, pack(index, tagOf(old) + 1),
+                                           std::memory_order_release, std::memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    std::unique_ptr<Node[]> nodes_;
+    std::size_t capacity_;
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> top_;         // Вершина стека элементов
+    alignas(CACHE_LINE_SIZE) std::atomic<std::uint64_t> free_;        // Вершина списка свободных узлов
+};
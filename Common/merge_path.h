@@ -0,0 +1,276 @@
+// Общая библиотека: сортировка слиянием с разбиением merge path и параллельное k-путевое слияние
+// mergeKernel (Assignment_2, assignment2task4) и gpuMergeKernel (Practice3task4) сливают снизу вверх по одной паре
+// на поток: на проходе с шириной w работает n / (2w) потоков, поэтому последние проходы (две половины массива)
+// выполняют один-два потока, а остальные простаивают. Здесь каждый проход делится поровну на все потоки:
+//   - mergePathCoRank — co-rank: сколько элементов a входит в первые k элементов слияния a и b (двоичный поиск по
+//     диагонали merge path), при равенстве первыми идут элементы a — слияние устойчиво;
+//   - parallelMergePath — слияние двух массивов: поток t пишет выход [t * n / p, (t + 1) * n / p), свои границы в a и b
+//     он находит co-rank, синхронизация не нужна;
+//   - mergePathSort — p отсортированных кусков (по одному на поток), затем log2 p проходов попарного слияния;
+//     на каждом проходе весь выход делится на p равных частей независимо от числа пар, включая последний проход;
+//   - LoserTree / loserTreeMerge — k-путевое слияние готовых отсортированных серий деревом проигравших
+//     (log2 k сравнений на элемент, устойчиво: при равенстве раньше идёт серия с меньшим номером);
+//   - parallelKWayMerge — то же на p потоках: выход делится на равные части разбиением нескольких серий
+//     (multiway co-rank), каждая часть сливается своим деревом проигравших.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <vector>        // Для серий и буферов
+#include <utility>       // Для pair / swap
+#include <algorithm>     // Для stable_sort, merge, copy, lower_bound, upper_bound
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"   // Для threadRange
+#include "arena.h"       // Для ScratchArray
+#include "parallel_sort.h"   // Для SORT_TASK_CUTOFF / MERGE_TASK_CUTOFF
+
+// Отсортированная серия [first, last)
+template <typename T>
+struct SortedRun {
+    const T* first = nullptr;
+    const T* last = nullptr;
+    std::size_t size() const { return static_cast<std::size_t>(last - first); }
+};
+
+// Co-rank: число элементов a среди первых k элементов устойчивого слияния a[0..na) и b[0..nb)
+template <typename T>
+std::size_t mergePathCoRank(std::size_t k, const T* a, std::size_t na, const T* b, std::size_t nb) {
+    std::size_t lo = k > nb ? k - nb : 0;            // Наименьшее возможное i
+    std::size_t hi = k < na ? k : na;                // Наибольшее возможное i
+    while (lo < hi) {                                // Ищем наименьшее i, при котором a[i] идёт после b[k - i - 1]
+        std::size_t i = lo + (hi - lo) / 2;
+        std::size_t j = k - i;
+        if (j > 0 && i < na && !(b[j - 1] < a[i])) { // b[j - 1] >= a[i]: a[i] попадает в первые k — берём больше a
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+// Кусок [k0, k1) устойчивого слияния a и b, записанный в out[k0 - k0 .. k1 - k0)
+template <typename T>
+void mergePathSegment(const T* a, std::size_t na, const T* b, std::size_t nb, std::size_t k0, std::size_t k1, T* out) {
+    std::size_t i0 = mergePathCoRank(k0, a, na, b, nb);
+    std::size_t i1 = mergePathCoRank(k1, a, na, b, nb);
+    std::merge(a + i0, a + i1, b + (k0 - i0), b + (k1 - i1), out);
+}
+
+// Параллельное устойчивое слияние a и b в out: каждый поток пишет равную часть выхода
+template <typename T>
+void parallelMergePath(const T* a, std::size_t na, const T* b, std::size_t nb, T* out) {
+    std::size_t n = na + nb;
+    #pragma omp parallel if (n >= MERGE_TASK_CUTOFF)
+    {
+        std::size_t k0, k1;
+        threadRange(n, omp_get_thread_num(), omp_get_num_threads(), k0, k1);
+        mergePathSegment(a, na, b, nb, k0, k1, out + k0);
+    }
+}
+
+// Один проход попарного слияния серий src (границы bounds) в dst; поток пишет выход [lo, hi).
+// Пара q — серии 2q и 2q + 1 (у последней нечётной серии пары нет — она копируется)
+template <typename T>
+void mergePathPass(const T* src, T* dst, const std::vector<std::size_t>& bounds, std::size_t lo, std::size_t hi) {
+    std::size_t runs = bounds.size() - 1;
+    for (std::size_t r = 0; r < runs && lo < hi; r += 2) {
+        std::size_t pairBegin = bounds[r];
+        std::size_t mid = bounds[r + 1];
+        std::size_t pairEnd = bounds[r + 2 <= runs ? r + 2 : r + 1];
+        if (pairEnd <= lo) continue;                 // Пара целиком левее своей части выхода
+        if (pairBegin >= hi) break;                  // Пары дальше — правее
+        std::size_t k0 = (lo > pairBegin ? lo : pairBegin) - pairBegin;
+        std::size_t k1 = (hi < pairEnd ? hi : pairEnd) - pairBegin;
+        mergePathSegment(src + pairBegin, mid - pairBegin, src + mid, pairEnd - mid, k0, k1, dst + pairBegin + k0);
+    }
+}
+
+// Сортировка слиянием с разбиением merge path (устойчивая)
+template <typename T>
+void mergePathSort(T* data, std::size_t n) {
+    int maxThreads = omp_get_max_threads();
+    if (maxThreads == 1 || n < SORT_TASK_CUTOFF) {
+        std::stable_sort(data, data + n);            // Маленький массив или один поток — без слияний
+        return;
+    }
+    ScratchArray<T> tmp(n);                          // Второй буфер (ping-pong, из арены потока)
+    std::vector<std::size_t> bounds;                 // Границы серий текущего прохода
+
+    #pragma omp parallel
+    {
+        int tid = omp_get_thread_num();
+        int nthreads = omp_get_num_threads();
+        #pragma omp single
+        {
+            bounds.resize(nthreads + 1);
+            for (int t = 0; t < nthreads; ++t) {
+                std::size_t begin, end;
+                threadRange(n, t, nthreads, begin, end);
+                bounds[t] = begin;
+            }
+            bounds[nthreads] = n;
+        }                                            // Неявный барьер после single
+
+        // 1. Серии: по одному куску на поток
+        std::stable_sort(data + bounds[tid], data + bounds[tid + 1]);
+
+        // 2. Проходы: выход делится на равные части по всем потокам независимо от числа пар
+        std::size_t lo, hi;
+        threadRange(n, tid, nthreads, lo, hi);
+        T* src = data;
+        T* dst = tmp.data();
+        #pragma omp barrier
+        while (bounds.size() > 2) {                  // Больше одной серии
+            mergePathPass(src, dst, bounds, lo, hi);
+            std::swap(src, dst);
+            #pragma omp barrier                      // Проход завершён у всех потоков
+            #pragma omp single
+            {
+                std::vector<std::size_t> next;       // Границы после прохода — каждая вторая
+                for (std::size_t r = 0; r + 1 < bounds.size(); r += 2) next.push_back(bounds[r]);
+                next.push_back(n);
+                bounds.swap(next);
+            }                                        // Неявный барьер: все видят новые границы
+        }
+
+        // 3. Результат мог остаться во временном буфере
+        if (src != data) std::copy(src + lo, src + hi, data + lo);
+    }
+}
+
+template <typename T>
+void mergePathSort(std::vector<T>& arr) {
+    mergePathSort(arr.data(), arr.size());
+}
+
+// Дерево проигравших над k сериями: в узлах — номера проигравших серий, победитель (наименьшая голова) — в tree[0].
+// Закончившаяся серия проигрывает всем; при равных головах выигрывает серия с меньшим номером
+template <typename T>
+class LoserTree {
+public:
+    explicit LoserTree(const std::vector<SortedRun<T>>& runs)
+        : heads_(runs), leaves_(1) {
+        while (leaves_ < heads_.size()) leaves_ *= 2;
+        tree_.assign(leaves_, 0);
+        if (!heads_.empty()) tree_[0] = build(1);
+    }
+
+    bool empty() const { return heads_.empty() || exhausted(tree_[0]); }
+
+    // Наименьший элемент всех серий (серии не пусты)
+    const T& top() const { return *heads_[tree_[0]].first; }
+
+    // Снять наименьший элемент и переиграть путь его серии
+    void pop() {
+        std::size_t winner = tree_[0];
+        ++heads_[winner].first;
+        for (std::size_t node = (winner + leaves_) / 2; node > 0; node /= 2) {
+            if (beats(tree_[node], winner)) std::swap(tree_[node], winner);
+        }
+        tree_[0] = winner;
+    }
+
+private:
+    bool exhausted(std::size_t r) const { return r >= heads_.size() || heads_[r].first == heads_[r].last; }
+
+    // Серия x выигрывает у y
+    bool beats(std::size_t x, std::size_t y) const {
+        if (exhausted(x)) return false;
+        if (exhausted(y)) return true;
+        const T& vx = *heads_[x].first;
+        const T& vy = *heads_[y].first;
+        return vx < vy || (!(vy < vx) && x < y);
+    }
+
+    // Турнир поддерева node: проигравший остаётся в узле, победитель возвращается
+    std::size_t build(std::size_t node) {
+        if (node >= leaves_) return node - leaves_;  // Лист — номер серии
+        std::size_t left = build(2 * node);
+        std::size_t right = build(2 * node + 1);
+        if (beats(left, right)) {
+            tree_[node] = right;
+            return left;
+        }
+        tree_[node] = left;
+        return right;
+    }
+
+    std::vector<SortedRun<T>> heads_;                // Непрочитанные остатки серий
+    std::size_t leaves_;                             // Листьев (степень двойки, не меньше числа серий)
+    std::vector<std::size_t> tree_;                  // tree_[0] — победитель, tree_[1..leaves_) — проигравшие
+};
+
+// Последовательное k-путевое слияние серий в out; возвращает число записанных элементов
+template <typename T>
+std::size_t loserTreeMerge(const std::vector<SortedRun<T>>& runs, T* out) {
+    LoserTree<T> tree(runs);
+    std::size_t k = 0;
+    while (!tree.empty()) {
+        out[k++] = tree.top();
+        tree.pop();
+    }
+    return k;
+}
+
+// Разбиение серий по рангу r: split[i] — сколько элементов серии i входит в первые r элементов слияния.
+// Порядок слияния — (значение, номер серии, позиция), поэтому разбиение единственно и сумма split равна r
+template <typename T>
+std::vector<std::size_t> multiwayCoRank(const std::vector<SortedRun<T>>& runs, std::size_t r) {
+    std::size_t k = runs.size();
+    std::vector<std::size_t> split(k, 0);
+    for (std::size_t i = 0; i < k; ++i) {
+        // Ранг элемента p серии i: элементы других серий, идущие раньше, плюс p. Ранг растёт с p —
+        // ищем, сколько элементов серии i имеют ранг меньше r
+        std::size_t lo = 0, hi = runs[i].size();
+        while (lo < hi) {
+            std::size_t p = lo + (hi - lo) / 2;
+            const T& value = runs[i].first[p];
+            std::size_t rank = p;
+            for (std::size_t j = 0; j < k && rank < r; ++j) {
+                if (j == i) continue;
+                const T* pos = j < i ? std::upper_bound(runs[j].first, runs[j].last, value)   // Равные из ранних серий раньше
+                                     : std::lower_bound(runs[j].first, runs[j].last, value);  // Равные из поздних — позже
+                rank += static_cast<std::size_t>(pos - runs[j].first);
+            }
+            if (rank < r) lo = p + 1;
+            else hi = p;
+        }
+        split[i] = lo;
+    }
+    return split;
+}
+
+// Параллельное k-путевое слияние: поток t пишет равную часть выхода, свою часть серий находит multiwayCoRank
+template <typename T>
+void parallelKWayMerge(const std::vector<SortedRun<T>>& runs, T* out) {
+    std::size_t n = 0;
+    for (const SortedRun<T>& run : runs) n += run.size();
+
+    #pragma omp parallel if (n >= MERGE_TASK_CUTOFF)
+    {
+        std::size_t lo, hi;
+        threadRange(n, omp_get_thread_num(), omp_get_num_threads(), lo, hi);
+        std::vector<std::size_t> from = multiwayCoRank(runs, lo);
+        std::vector<std::size_t> to = multiwayCoRank(runs, hi);
+        std::vector<SortedRun<T>> part(runs.size());
+        for (std::size_t i = 0; i < runs.size(); ++i) {
+            part[i].first = runs[i].first + from[i];
+            part[i].last = runs[i].first + to[i];
+        }
+        loserTreeMerge(part, out + lo);
+    }
+}
+
+// Серии подряд в одном массиве: data[offsets[i] .. offsets[i + 1])
+template <typename T>
+std::vector<SortedRun<T>> runsFromOffsets(const T* data, const std::vector<std::size_t>& offsets) {
+    std::vector<SortedRun<T>> runs;
+    for (std::size_t i = 0; i + 1 < offsets.size(); ++i) {
+        SortedRun<T> run;
+        run.first = data + offsets[i];
+        run.last = data + offsets[i + 1];
+        runs.push_back(run);
+    }
+    return runs;
+}
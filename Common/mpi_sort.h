@@ -0,0 +1,222 @@
+// Общая библиотека: распределённая сортировка выборкой (sample sort) на процессах MPI
+// MPI в курсе использовался только для суммы (assignment44.cpp), а все сортировки работали в одном процессе,
+// то есть массив ограничен памятью одной машины. Здесь массив с самого начала разложен по процессам:
+//   - каждый процесс сортирует свой кусок (parallelSampleSort — внутри процесса на потоках OpenMP);
+//   - регулярная выборка (PSRS): равноотстоящие образцы отсортированного куска каждого процесса (MPI_SORT_SAMPLES_PER_RANK,
+//     но не меньше size), MPI_Allgatherv, из отсортированных образцов всех процессов — size - 1 разделителей;
+//     образцов больше, чем size - 1 классического PSRS, поэтому куски после обмена отличаются от среднего
+//     примерно на 1 / MPI_SORT_SAMPLES_PER_RANK и на уже отсортированных данных;
+//   - разделители сравниваются по ключу (значение, процесс, индекс в куске): повторяющиеся значения делятся между
+//     процессами, а не попадают все к одному (без этого на few-unique самый большой кусок в 1.25 раза больше среднего);
+//   - отсортированный кусок уже разбит разделителями на подряд идущие части (lower_bound / upper_bound), поэтому
+//     MPI_Alltoallv отправляет их прямо из массива, без копирования;
+//   - процесс получает size отсортированных частей и сливает их k-путевым слиянием на потоках процесса
+//     (parallelKWayMerge из merge_path.h — дерево проигравших, выход поровну делится между потоками);
+//   - проверка: каждый кусок отсортирован и последний элемент процесса не больше первого элемента следующего.
+// Каждый процесс держит только свой кусок (в пике — кусок и принятые части), весь массив не собирается нигде.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <climits>       // Для INT_MAX
+#include <vector>        // Для кусков и буферов
+#include <algorithm>     // Для lower_bound / upper_bound / is_sorted
+#include <stdexcept>     // Для length_error
+#include <mpi.h>         // MPI библиотека для распределённых вычислений
+#include "parallel_sort.h"   // Для parallelSampleSort
+#include "merge_path.h"      // Для parallelKWayMerge
+
+const int MPI_SORT_SAMPLES_PER_RANK = 64;            // Образцов с каждого процесса (не меньше числа процессов)
+
+// Тип MPI для элементов
+template <typename T> struct MpiType;
+template <> struct MpiType<int> { static MPI_Datatype get() { return MPI_INT; } };
+template <> struct MpiType<unsigned> { static MPI_Datatype get() { return MPI_UNSIGNED; } };
+template <> struct MpiType<long long> { static MPI_Datatype get() { return MPI_LONG_LONG; } };
+template <> struct MpiType<unsigned long long> { static MPI_Datatype get() { return MPI_UNSIGNED_LONG_LONG; } };
+template <> struct MpiType<float> { static MPI_Datatype get() { return MPI_FLOAT; } };
+template <> struct MpiType<double> { static MPI_Datatype get() { return MPI_DOUBLE; } };
+
+// Ключ элемента при выборе разделителей: значение, затем процесс и индекс в его отсортированном куске
+template <typename T>
+struct MpiSortKey {
+    T value;
+    int rank;
+    long long position;
+
+    bool operator<(const MpiSortKey& other) const {
+        if (value < other.value) return true;
+        if (other.value < value) return false;
+        if (rank != other.rank) return rank < other.rank;
+        return position < other.position;
+    }
+};
+
+// Конец части в отсортированном куске процесса rank: первый индекс от begin, ключ которого больше splitter
+template <typename T>
+std::size_t mpiSplitPosition(const std::vector<T>& local, std::size_t begin, const MpiSortKey<T>& splitter, int rank) {
+    auto first = local.begin() + begin;
+    if (rank < splitter.rank) {                      // Равные значения этого процесса — до разделителя
+        return static_cast<std::size_t>(std::upper_bound(first, local.end(), splitter.value) - local.begin());
+    }
+    std::size_t lower = static_cast<std::size_t>(std::lower_bound(first, local.end(), splitter.value) - local.begin());
+    if (rank > splitter.rank) return lower;          // Равные значения этого процесса — после разделителя
+    // Разделитель взят из этого куска: равные значения до него включительно
+    std::size_t upper = static_cast<std::size_t>(std::upper_bound(first, local.end(), splitter.value) - local.begin());
+    std::size_t end = static_cast<std::size_t>(splitter.position) + 1;
+    return std::min(std::max(end, lower), upper);
+}
+
+// Время этапов на этом процессе (ms) и размер куска после обмена
+struct MpiSortStats {
+    double localSortMs = 0;            // Сортировка своего куска
+    double splittersMs = 0;            // Выборка и разделители
+    double exchangeMs = 0;             // Обмен частями (Alltoall счётчиков и Alltoallv данных)
+    double mergeMs = 0;                // k-путевое слияние принятых частей
+    std::size_t received = 0;          // Элементов после обмена
+};
+
+// Сортировка распределённого массива: local — кусок этого процесса; после вызова local — кусок результата
+// (все элементы процесса r не больше элементов процесса r + 1). Размеры кусков после обмена различаются.
+// Коллективная операция: вызывают все процессы comm
+template <typename T>
+void mpiSampleSort(std::vector<T>& local, MPI_Comm comm, MpiSortStats* stats = nullptr) {
+    int rank = 0, size = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    MPI_Datatype type = MpiType<T>::get();
+    if (local.size() > static_cast<std::size_t>(INT_MAX)) {
+        throw std::length_error("mpiSampleSort: кусок процесса больше INT_MAX (счётчики MPI — int)");
+    }
+    MpiSortStats localStats;
+    double t0 = MPI_Wtime();
+
+    // 1. Локальная сортировка
+    parallelSampleSort(local);
+    double t1 = MPI_Wtime();
+    localStats.localSortMs = (t1 - t0) * 1000;
+    if (size == 1) {
+        localStats.received = local.size();
+        if (stats) *stats = localStats;
+        return;
+    }
+
+    // 2. Регулярная выборка: s образцов в серединах s равных отрезков куска (меньше, если кусок короче).
+    //    Элементы упорядочены по ключу (значение, процесс, индекс в куске): равные значения различаются
+    //    местом, поэтому разделители с одним значением делят повторяющиеся ключи между процессами
+    std::size_t n = local.size();
+    std::size_t s = static_cast<std::size_t>(std::max(MPI_SORT_SAMPLES_PER_RANK, size));
+    if (s > n) s = n;
+    std::vector<T> samples(s);
+    std::vector<long long> samplePositions(s);
+    for (std::size_t i = 0; i < s; ++i) {
+        samplePositions[i] = static_cast<long long>((2 * i + 1) * n / (2 * s));
+        samples[i] = local[static_cast<std::size_t>(samplePositions[i])];
+    }
+    int sampleCount = static_cast<int>(samples.size());
+    std::vector<int> sampleCounts(size), sampleDispls(size);
+    MPI_Allgather(&sampleCount, 1, MPI_INT, sampleCounts.data(), 1, MPI_INT, comm);
+    int totalSamples = 0;
+    for (int r = 0; r < size; ++r) {
+        sampleDispls[r] = totalSamples;
+        totalSamples += sampleCounts[r];
+    }
+    std::vector<T> allSamples(totalSamples);
+    std::vector<long long> allPositions(totalSamples);
+    MPI_Allgatherv(samples.data(), sampleCount, type, allSamples.data(), sampleCounts.data(), sampleDispls.data(),
+                   type, comm);
+    MPI_Allgatherv(samplePositions.data(), sampleCount, MPI_LONG_LONG, allPositions.data(), sampleCounts.data(),
+                   sampleDispls.data(), MPI_LONG_LONG, comm);
+    std::vector<MpiSortKey<T>> keys(totalSamples);
+    for (int r = 0; r < size; ++r) {
+        for (int i = sampleDispls[r]; i < sampleDispls[r] + sampleCounts[r]; ++i) {
+            keys[i] = {allSamples[i], r, allPositions[i]};
+        }
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<MpiSortKey<T>> splitters;            // size - 1 разделителей (пусто, если массив пуст)
+    for (int i = 1; i < size && totalSamples > 0; ++i) {
+        splitters.push_back(keys[static_cast<std::size_t>(i) * totalSamples / size]);
+    }
+    double t2 = MPI_Wtime();
+    localStats.splittersMs = (t2 - t1) * 1000;
+
+    // 3. Части для процессов: часть r — элементы с ключами из (splitters[r - 1], splitters[r]]
+    std::vector<int> sendCounts(size, 0), sendDispls(size, 0);
+    std::size_t begin = 0;
+    for (int r = 0; r < size; ++r) {
+        std::size_t end = n;
+        if (r < static_cast<int>(splitters.size())) {
+            end = mpiSplitPosition(local, begin, splitters[r], rank);
+        }
+        sendDispls[r] = static_cast<int>(begin);
+        sendCounts[r] = static_cast<int>(end - begin);
+        begin = end;
+    }
+
+    std::vector<int> recvCounts(size), recvDispls(size);
+    MPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm);
+    std::size_t received = 0;
+    std::vector<std::size_t> offsets(size + 1, 0);
+    for (int r = 0; r < size; ++r) {
+        if (received > static_cast<std::size_t>(INT_MAX)) {
+            throw std::length_error("mpiSampleSort: принятый кусок больше INT_MAX (смещения MPI — int)");
+        }
+        recvDispls[r] = static_cast<int>(received);
+        offsets[r] = received;
+        received += recvCounts[r];
+    }
+    offsets[size] = received;
+
+    std::vector<T> incoming(received);
+    MPI_Alltoallv(local.data(), sendCounts.data(), sendDispls.data(), type,
+                  incoming.data(), recvCounts.data(), recvDispls.data(), type, comm);
+    double t3 = MPI_Wtime();
+    localStats.exchangeMs = (t3 - t2) * 1000;
+
+    // 4. Слияние size отсортированных частей
+    local.resize(received);
+    parallelKWayMerge(runsFromOffsets(incoming.data(), offsets), local.data());
+    double t4 = MPI_Wtime();
+    localStats.mergeMs = (t4 - t3) * 1000;
+    localStats.received = received;
+    if (stats) *stats = localStats;
+}
+
+// Проверка глобального порядка: каждый кусок отсортирован, последний элемент каждого непустого куска не больше
+// первого элемента следующего непустого куска. Результат одинаков на всех процессах
+template <typename T>
+bool mpiIsSorted(const std::vector<T>& local, MPI_Comm comm) {
+    int rank = 0, size = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    MPI_Datatype type = MpiType<T>::get();
+
+    int localOk = std::is_sorted(local.begin(), local.end()) ? 1 : 0;
+    int nonEmpty = local.empty() ? 0 : 1;
+    T ends[2] = {T(), T()};                          // Первый и последний элемент куска
+    if (nonEmpty) {
+        ends[0] = local.front();
+        ends[1] = local.back();
+    }
+    std::vector<int> flags(size);
+    std::vector<T> allEnds(2 * static_cast<std::size_t>(size));
+    MPI_Allgather(&nonEmpty, 1, MPI_INT, flags.data(), 1, MPI_INT, comm);
+    MPI_Allgather(ends, 2, type, allEnds.data(), 2, type, comm);
+
+    int bordersOk = 1;
+    bool havePrevious = false;
+    T previousLast = T();
+    for (int r = 0; r < size; ++r) {
+        if (!flags[r]) continue;
+        if (havePrevious && allEnds[2 * r] < previousLast) bordersOk = 0;
+        previousLast = allEnds[2 * r + 1];
+        havePrevious = true;
+    }
+
+    int ok = localOk && bordersOk;
+    int allOk = 0;
+    MPI_Allreduce(&ok, &allOk, 1, MPI_INT, MPI_MIN, comm);
+    return allOk != 0;
+}
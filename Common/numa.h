@@ -0,0 +1,204 @@
+// Общая библиотека: размещение памяти по узлам NUMA (first touch) и закрепление потоков за ядрами
+// Все программы выделяли массив через new int[SIZE] или vector<int> и заполняли его одним главным потоком
+// (assignment1_task4 — 5 000 000 элементов). Linux выделяет физическую страницу на узле того потока, который первым
+// к ней обратился (first touch), поэтому весь массив оказывался на узле главного потока, и потоки omp parallel for
+// с других сокетов читали его через межсокетную шину. Здесь:
+//   - NumaBuffer<T> — массив на PageBuffer, который заполняется параллельно с schedule(static): кусок каждого потока
+//     совпадает с куском, который тот же поток потом читает в parallelSum / hierarchicalSum и циклах
+//     omp parallel for schedule(static) (threadRange), и страницы куска ложатся на узел этого потока;
+//   - pinOpenMPThreads(policy) — закрепление потоков OpenMP: compact — подряд ядра одного узла, затем следующего
+//     (потоки делят кэш L3 узла), scatter — по очереди на разные узлы (больше каналов памяти при малом числе потоков);
+//     None — вернуть исходную маску процесса. Аналог переменных OMP_PROC_BIND=close / spread, но из программы;
+//   - pageNodeHistogram — на каком узле лежат страницы массива (системный вызов move_pages, только запрос).
+// Закрепление действует на текущие потоки OpenMP: после изменения числа потоков pinOpenMPThreads нужно вызвать снова
+// (новые потоки наследуют маску создавшего их потока). Закреплять потоки нужно до заполнения массива.
+// На системах без sched_setaffinity / move_pages закрепление ничего не делает, а гистограмма пуста.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <cstdint>       // Для uintptr_t
+#include <string>        // Для имён политик
+#include <vector>        // Для списков ядер
+#include <algorithm>     // Для stable_sort
+#include <type_traits>   // Для is_trivially_copyable
+#include <omp.h>         // Для OpenMP
+#include "topology.h"    // Для cpuNodeMap / numaNodeCount
+#include "page_buffer.h" // Для PageBuffer
+#ifdef __linux__
+#include <sched.h>       // Для sched_getaffinity / sched_setaffinity
+#include <unistd.h>      // Для syscall
+#include <sys/syscall.h> // Для SYS_move_pages
+#endif
+
+// Политика закрепления потоков
+enum class PinPolicy {
+    None,             // Без закрепления (исходная маска процесса, потоки может переносить планировщик)
+    Compact,          // Поток t — t-е ядро в порядке (узел, номер ядра)
+    Scatter           // Потоки по очереди на узлы 0, 1, ..., затем вторые ядра узлов и т.д.
+};
+
+inline const char* pinPolicyName(PinPolicy policy) {
+    switch (policy) {
+        case PinPolicy::Compact: return "compact";
+        case PinPolicy::Scatter: return "scatter";
+        default: return "none";
+    }
+}
+
+inline bool parsePinPolicy(const std::string& name, PinPolicy& policy) {
+    if (name == "none") policy = PinPolicy::None;
+    else if (name == "compact") policy = PinPolicy::Compact;
+    else if (name == "scatter") policy = PinPolicy::Scatter;
+    else return false;
+    return true;
+}
+
+// Ядра, на которых процессу разрешено работать при запуске (маска запоминается при первом вызове)
+inline const std::vector<int>& allowedCpus() {
+    static const std::vector<int> cpus = [] {
+        std::vector<int> ids;
+#ifdef __linux__
+        cpu_set_t mask;
+        CPU_ZERO(&mask);
+        if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                if (CPU_ISSET(cpu, &mask)) ids.push_back(cpu);
+            }
+        }
+#endif
+        return ids;
+    }();
+    return cpus;
+}
+
+// Узел ядра (0, если неизвестно)
+inline int cpuNode(int cpu) {
+    const std::vector<int>& map = cpuNodeMap();
+    return cpu >= 0 && cpu < static_cast<int>(map.size()) ? map[cpu] : 0;
+}
+
+// Порядок ядер для политики: поток t закрепляется за order[t % order.size()]; для None — пусто
+inline std::vector<int> pinOrder(PinPolicy policy) {
+    std::vector<int> cpus = allowedCpus();
+    if (policy == PinPolicy::None || cpus.empty()) return std::vector<int>();
+    std::stable_sort(cpus.begin(), cpus.end(), [](int a, int b) { return cpuNode(a) < cpuNode(b); });
+    if (policy == PinPolicy::Compact) return cpus;
+
+    std::vector<std::vector<int>> byNode(numaNodeCount());            // Scatter: по одному ядру с каждого узла по кругу
+    for (int cpu : cpus) byNode[cpuNode(cpu)].push_back(cpu);
+    std::vector<int> order;
+    for (std::size_t round = 0; order.size() < cpus.size(); ++round) {
+        for (const std::vector<int>& nodeCpus : byNode) {
+            if (round < nodeCpus.size()) order.push_back(nodeCpus[round]);
+        }
+    }
+    return order;
+}
+
+// Маска текущего потока: только ядра cpus (пусто — исходная маска процесса); false — не удалось
+inline bool setCurrentThreadCpus(const std::vector<int>& cpus) {
+#ifdef __linux__
+    const std::vector<int>& ids = cpus.empty() ? allowedCpus() : cpus;
+    if (ids.empty()) return false;
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (int cpu : ids) CPU_SET(cpu, &mask);
+    return sched_setaffinity(0, sizeof(mask), &mask) == 0;             // pid 0 — вызывающий поток
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+// Закрепление всех потоков текущей команды OpenMP по политике; false — хотя бы один поток не закреплён
+inline bool pinOpenMPThreads(PinPolicy policy) {
+    allowedCpus();                                   // Исходная маска — до первого закрепления
+    std::vector<int> order = pinOrder(policy);
+    int failed = 0;
+    #pragma omp parallel reduction(+ : failed)
+    {
+        std::vector<int> cpus;
+        if (!order.empty()) cpus.push_back(order[omp_get_thread_num() % order.size()]);
+        failed += setCurrentThreadCpus(cpus) ? 0 : 1;
+    }
+    return failed == 0;
+}
+
+// Узел NUMA каждого потока команды OpenMP (индекс — номер потока)
+inline std::vector<int> openMPThreadNodes() {
+    std::vector<int> nodes(omp_get_max_threads(), 0);
+    #pragma omp parallel
+    nodes[omp_get_thread_num()] = currentNumaNode();
+    return nodes;
+}
+
+// Страниц по узлам для области [data, data + bytes) (индекс — узел); пусто — move_pages недоступен.
+// Страницы, к которым ещё не обращались, не считаются
+inline std::vector<std::size_t> pageNodeHistogram(const void* data, std::size_t bytes) {
+    std::vector<std::size_t> histogram;
+#if defined(__linux__) && defined(SYS_move_pages)
+    const std::size_t batch = 4096;                  // Страниц за один вызов
+    std::uintptr_t first = reinterpret_cast<std::uintptr_t>(data) & ~(SMALL_PAGE_SIZE - 1);
+    std::uintptr_t last = reinterpret_cast<std::uintptr_t>(data) + bytes;
+    std::vector<void*> pages;
+    std::vector<int> status;
+    histogram.assign(numaNodeCount(), 0);
+    for (std::uintptr_t page = first; page < last;) {
+        pages.clear();
+        for (; page < last && pages.size() < batch; page += SMALL_PAGE_SIZE) pages.push_back(reinterpret_cast<void*>(page));
+        status.assign(pages.size(), -1);
+        // nodes = nullptr: только узел каждой страницы, ничего не переносится
+        if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0) return std::vector<std::size_t>();
+        for (int node : status) {
+            if (node < 0) continue;                  // -ENOENT: страница ещё не выделена
+            if (node >= static_cast<int>(histogram.size())) histogram.resize(node + 1, 0);
+            ++histogram[node];
+        }
+    }
+#else
+    (void)data;
+    (void)bytes;
+#endif
+    return histogram;
+}
+
+// Массив n элементов T, страницы которого распределены по узлам потоков, которые с ним работают.
+// Заполнение — параллельный цикл schedule(static) текущей командой OpenMP; только перемещение
+template <typename T>
+class NumaBuffer {
+    static_assert(std::is_trivially_copyable<T>::value, "NumaBuffer: элементы записываются в сырую память");
+
+public:
+    NumaBuffer() = default;
+
+    // Элементы T() (значения типа обнуляются параллельно, страницы выделяются там же)
+    explicit NumaBuffer(std::size_t n, PageMode mode = PageMode::Default)
+        : NumaBuffer(n, [](std::size_t) { return T(); }, mode) {}
+
+    // Элемент i — value(i); value вызывается из разных потоков
+    template <typename Generator>
+    NumaBuffer(std::size_t n, Generator value, PageMode mode = PageMode::Default)
+        : buffer_(n * sizeof(T), mode), n_(n) {
+        T* data = buffer_.as<T>();
+        #pragma omp parallel for schedule(static)
+        for (std::size_t i = 0; i < n; ++i) data[i] = value(i);
+    }
+
+    T* data() { return buffer_.as<T>(); }
+    const T* data() const { return buffer_.as<T>(); }
+    std::size_t size() const { return n_; }
+    T& operator[](std::size_t i) { return data()[i]; }
+    const T& operator[](std::size_t i) const { return data()[i]; }
+    T* begin() { return data(); }
+    T* end() { return data() + n_; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + n_; }
+
+    // Страниц массива по узлам
+    std::vector<std::size_t> nodeHistogram() const { return pageNodeHistogram(data(), n_ * sizeof(T)); }
+
+private:
+    PageBuffer buffer_;
+    std::size_t n_ = 0;
+};
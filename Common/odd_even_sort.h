@@ -0,0 +1,112 @@
+// Общая библиотека: блочная чётно-нечётная сортировка перестановками (odd-even transposition sort)
+// Замена bubbleSortParallel из Practice2: там #pragma omp parallel for стоял на внутреннем цикле j,
+// соседние итерации меняли пересекающиеся пары (гонка данных) и команда создавалась n раз. Здесь:
+//   - одна команда из p потоков, массив делится на p блоков, каждый поток сортирует свой блок;
+//   - затем p фаз: в чётной фазе пары блоков (0,1), (2,3), ..., в нечётной — (1,2), (3,4), ...;
+//   - в паре выполняется merge-split: левый блок получает меньшую половину слияния, правый — большую;
+//     оба потока пары работают одновременно (левый сливает с начала, правый — с конца);
+//   - фазы разделены барьерами, поэтому результат детерминирован;
+//   - при равных блоках хватает p фаз, но при блоках разного размера (n не делится на p) может понадобиться
+//     больше, поэтому сортировка заканчивается, когда две фазы подряд (чётная и нечётная) ничего не поменяли:
+//     тогда все соседние блоки упорядочены.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <vector>        // Для буферов потоков
+#include <algorithm>     // Для sort и copy
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"   // Для threadRange
+
+const std::size_t ODD_EVEN_MIN_BLOCK = 4096;     // Минимальный размер блока на поток
+
+// Флаг "блок изменился в фазе" одного потока, выровнен по кэш-линии
+struct alignas(CACHE_LINE_SIZE) OddEvenFlag {
+    bool changed = false;
+};
+
+// Первые count элементов слияния a[0..na) и b[0..nb) (при равенстве сначала a)
+template <typename T>
+void mergeLowerPart(const T* a, std::size_t na, const T* b, std::size_t nb, T* out, std::size_t count) {
+    std::size_t i = 0, j = 0;
+    for (std::size_t k = 0; k < count; ++k) {
+        if (j >= nb || (i < na && !(b[j] < a[i]))) out[k] = a[i++];
+        else out[k] = b[j++];
+    }
+}
+
+// Последние count элементов слияния a[0..na) и b[0..nb) (при равенстве с конца сначала b)
+template <typename T>
+void mergeUpperPart(const T* a, std::size_t na, const T* b, std::size_t nb, T* out, std::size_t count) {
+    std::size_t i = na, j = nb;                       // Индексы "за последним" элементом
+    for (std::size_t k = count; k > 0; --k) {
+        if (i == 0 || (j > 0 && !(b[j - 1] < a[i - 1]))) out[k - 1] = b[--j];
+        else out[k - 1] = a[--i];
+    }
+}
+
+// Параллельная блочная чётно-нечётная сортировка
+template <typename T>
+void oddEvenSortParallel(T* data, std::size_t n) {
+    std::size_t byBlock = n / ODD_EVEN_MIN_BLOCK;     // Сколько блоков допускает размер массива
+    int threads = omp_get_max_threads();
+    if (byBlock < static_cast<std::size_t>(threads)) threads = static_cast<int>(byBlock);
+    if (threads < 2) {                                // Один блок — обычная сортировка
+        std::sort(data, data + n);
+        return;
+    }
+
+    std::vector<OddEvenFlag> flags(3 * static_cast<std::size_t>(threads)); // Три строки флагов: фазы k-1, k и k+1
+
+    #pragma omp parallel num_threads(threads)
+    {
+        int tid = omp_get_thread_num();
+        int p = omp_get_num_threads();                // Фактическое число блоков
+        std::size_t begin, end;
+        threadRange(n, tid, p, begin, end);           // Свой блок
+        std::sort(data + begin, data + end);          // Локальная сортировка блока
+        std::vector<T> buffer(end - begin);           // Буфер результата merge-split
+        #pragma omp barrier
+
+        for (std::size_t phase = 0; ; ++phase) {
+            // Партнёр по фазе: в чётной фазе чётный блок работает с правым соседом, в нечётной — нечётный
+            int partner = (static_cast<std::size_t>(tid % 2) == phase % 2) ? tid + 1 : tid - 1;
+            bool active = partner >= 0 && partner < p;
+            bool changed = false;
+
+            if (active) {
+                std::size_t pb, pe;
+                threadRange(n, partner, p, pb, pe);   // Блок партнёра
+                bool isLeft = partner > tid;
+                const T* left = isLeft ? data + begin : data + pb;
+                std::size_t nl = isLeft ? end - begin : pe - pb;
+                const T* right = isLeft ? data + pb : data + begin;
+                std::size_t nr = isLeft ? pe - pb : end - begin;
+
+                if (right[0] < left[nl - 1]) {        // Блоки перекрываются — нужен обмен половинами
+                    if (isLeft) mergeLowerPart(left, nl, right, nr, buffer.data(), end - begin);
+                    else mergeUpperPart(left, nl, right, nr, buffer.data(), end - begin);
+                    changed = true;
+                }
+            }
+            #pragma omp barrier                       // Оба потока пары дочитали блоки
+
+            if (changed) std::copy(buffer.begin(), buffer.end(), data + begin);
+            flags[(phase % 3) * threads + tid].changed = changed;
+            #pragma omp barrier                       // Фаза закончена
+
+            if (phase == 0) continue;                 // Нужны две фазы подряд
+            bool anyChange = false;                   // Все потоки читают одни и те же флаги — решение общее
+            for (int t = 0; t < p; ++t) {
+                anyChange = anyChange || flags[(phase % 3) * threads + t].changed
+                                      || flags[((phase - 1) % 3) * threads + t].changed;
+            }
+            if (!anyChange) break;
+        }
+    }
+}
+
+template <typename T>
+void oddEvenSortParallel(std::vector<T>& arr) {
+    oddEvenSortParallel(arr.data(), arr.size());
+}
@@ -0,0 +1,155 @@
+// Общая библиотека: буфер памяти со страницами заданного размера (4 КБ или 2 МБ)
+// Массивы программ выделялись через vector / new, и размер страниц решало ядро ОС. При случайном доступе к большому
+// массиву каждое обращение — промах TLB: 4-КБ страниц в 256 МБ — 65 536, а TLB второго уровня держит 1-2 тысячи
+// записей. С 2-МБ страницами тот же массив — 128 страниц. Здесь:
+//   - PageBuffer — RAII-буфер (Linux: анонимный mmap, выровненный на 2 МБ; madvise(MADV_HUGEPAGE) или
+//     madvise(MADV_NOHUGEPAGE)), память не инициализируется — страницы выделяет первое обращение (first touch),
+//     поэтому заполнять буфер нужно теми же потоками, что потом с ним работают;
+//   - hugePageBytes — сколько байт буфера на самом деле лежит в 2-МБ страницах (AnonHugePages из /proc/self/smaps):
+//     при transparent_hugepage=never или нехватке непрерывной памяти ядро тихо оставляет 4-КБ страницы;
+//   - на других системах буфер выделяется обычным выровненным new, режим страниц не учитывается.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <cstdint>       // Для uintptr_t
+#include <string>        // Для имён режимов и разбора smaps
+#include <fstream>       // Для чтения /proc/self/smaps
+#include <sstream>       // Для разбора строк smaps
+#include <new>           // Для bad_alloc
+#include <utility>       // Для swap
+#ifdef __linux__
+#include <sys/mman.h>    // Для mmap / munmap / madvise
+#endif
+
+const std::size_t SMALL_PAGE_SIZE = 4096;                 // Обычная страница x86 / ARM
+const std::size_t HUGE_PAGE_SIZE = 2 << 20;               // Большая страница (transparent huge pages)
+
+// Размер страниц буфера
+enum class PageMode {
+    Default,          // Как решит ОС (transparent_hugepage=always — большие, madvise — обычные)
+    Small,            // Только 4-КБ страницы (MADV_NOHUGEPAGE)
+    Huge              // 2-МБ страницы (MADV_HUGEPAGE), если ядро может их выделить
+};
+
+inline const char* pageModeName(PageMode mode) {
+    switch (mode) {
+        case PageMode::Small: return "4k";
+        case PageMode::Huge: return "2m";
+        default: return "default";
+    }
+}
+
+inline bool parsePageMode(const std::string& name, PageMode& mode) {
+    if (name == "default") mode = PageMode::Default;
+    else if (name == "4k") mode = PageMode::Small;
+    else if (name == "2m") mode = PageMode::Huge;
+    else return false;
+    return true;
+}
+
+// Буфер bytes байт, выровненный на HUGE_PAGE_SIZE; только перемещение
+class PageBuffer {
+public:
+    PageBuffer() = default;
+
+    PageBuffer(std::size_t bytes, PageMode mode) : bytes_(bytes), mode_(mode) {
+        if (bytes == 0) return;
+#ifdef __linux__
+        mapped_ = (bytes + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE + HUGE_PAGE_SIZE;  // Запас на выравнивание
+        void* base = mmap(nullptr, mapped_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) throw std::bad_alloc();
+        base_ = base;
+        std::uintptr_t aligned = (reinterpret_cast<std::uintptr_t>(base) + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        data_ = reinterpret_cast<void*>(aligned);
+        std::size_t span = mapped_ - (aligned - reinterpret_cast<std::uintptr_t>(base));
+#ifdef MADV_HUGEPAGE
+        if (mode == PageMode::Huge) madvise(data_, span, MADV_HUGEPAGE);       // Ошибка не страшна: останутся 4 КБ
+        if (mode == PageMode::Small) madvise(data_, span, MADV_NOHUGEPAGE);
+#else
+        (void)span;
+#endif
+#else
+        base_ = ::operator new(bytes + HUGE_PAGE_SIZE);
+        std::uintptr_t aligned = (reinterpret_cast<std::uintptr_t>(base_) + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        data_ = reinterpret_cast<void*>(aligned);
+#endif
+    }
+
+    ~PageBuffer() { release(); }
+
+    PageBuffer(const PageBuffer&) = delete;
+    PageBuffer& operator=(const PageBuffer&) = delete;
+
+    PageBuffer(PageBuffer&& other) noexcept { swap(other); }
+    PageBuffer& operator=(PageBuffer&& other) noexcept {
+        if (this != &other) {
+            release();
+            swap(other);
+        }
+        return *this;
+    }
+
+    void* data() const { return data_; }
+    std::size_t bytes() const { return bytes_; }
+    PageMode mode() const { return mode_; }
+
+    // Буфер как массив элементов T
+    template <typename T>
+    T* as() const { return static_cast<T*>(data_); }
+
+private:
+    void release() {
+        if (!base_) return;
+#ifdef __linux__
+        munmap(base_, mapped_);
+#else
+        ::operator delete(base_);
+#endif
+        base_ = data_ = nullptr;
+        mapped_ = bytes_ = 0;
+    }
+
+    void swap(PageBuffer& other) noexcept {
+        std::swap(base_, other.base_);
+        std::swap(data_, other.data_);
+        std::swap(mapped_, other.mapped_);
+        std::swap(bytes_, other.bytes_);
+        std::swap(mode_, other.mode_);
+    }
+
+    void* base_ = nullptr;             // Начало выделенной области (для освобождения)
+    void* data_ = nullptr;             // Выровненное начало буфера
+    std::size_t mapped_ = 0;           // Размер выделенной области
+    std::size_t bytes_ = 0;            // Запрошенный размер
+    PageMode mode_ = PageMode::Default;
+};
+
+// Байт области [data, data + bytes), лежащих в больших страницах (по AnonHugePages отображений, которые её
+// пересекают); 0 — нет больших страниц или /proc недоступен. Вызывать после первого обращения к памяти
+inline std::size_t hugePageBytes(const void* data, std::size_t bytes) {
+    std::ifstream smaps("/proc/self/smaps");
+    std::uintptr_t first = reinterpret_cast<std::uintptr_t>(data), last = first + bytes;
+    std::string line;
+    bool inside = false;
+    std::size_t total = 0;
+    while (std::getline(smaps, line)) {
+        std::size_t dash = line.find('-');
+        std::size_t space = line.find(' ');
+        if (dash != std::string::npos && space != std::string::npos && dash < space
+            && line.find_first_not_of("0123456789abcdef") == dash) {          // Заголовок отображения "start-end ..."
+            std::uintptr_t start = std::stoull(line.substr(0, dash), nullptr, 16);
+            std::uintptr_t end = std::stoull(line.substr(dash + 1, space - dash - 1), nullptr, 16);
+            inside = start < last && first < end;
+        } else if (inside && line.compare(0, 14, "AnonHugePages:") == 0) {
+            std::istringstream fields(line.substr(14));
+            std::size_t kb = 0;
+            fields >> kb;
+            total += kb * 1024;
+        }
+    }
+    return total < bytes ? total : bytes;
+}
+
+// То же для буфера
+inline std::size_t hugePageBytes(const PageBuffer& buffer) { return hugePageBytes(buffer.data(), buffer.bytes()); }
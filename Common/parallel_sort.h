@@ -0,0 +1,212 @@
+// Общая библиотека: параллельные сортировки O(n log n)
+// Замена сортировок O(n^2) из Practice2 с тем же интерфейсом vector<int>&:
+//   - parallelMergeSort — сортировка слиянием на задачах OpenMP (omp task), слияние тоже параллельное;
+//     маленькие куски сортируются вставками, буферы чередуются (ping-pong), поэтому лишних копирований нет;
+//   - parallelSampleSort — сортировка выборкой (samplesort): разделители по случайной выборке (пары
+//     (значение, позиция), поэтому повторяющиеся ключи делятся между корзинами), распределение элементов по корзинам с гистограммами потоков, корзины сортируются параллельно.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <vector>        // Для vector и временных буферов
+#include <algorithm>     // Для sort, merge, lower_bound, upper_bound, copy
+#include <utility>       // Для pair (образцы samplesort)
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"   // Для threadRange и CACHE_LINE_SIZE
+#include "arena.h"       // Для ScratchArray
+
+const std::size_t SORT_INSERTION_CUTOFF = 32;        // Куски меньше этого размера сортируются вставками
+const std::size_t SORT_TASK_CUTOFF = 1 << 14;        // Куски меньше этого размера не порождают новые задачи
+const std::size_t MERGE_TASK_CUTOFF = 1 << 15;       // Слияния меньше этого размера выполняются последовательно
+const std::size_t SAMPLE_SORT_OVERSAMPLING = 64;     // Количество образцов на одну корзину
+const std::size_t SAMPLE_SORT_BUCKETS_PER_THREAD = 4;// Корзин на поток (для балансировки нагрузки)
+
+// Сортировка вставками куска [data, data + n)
+template <typename T>
+void insertionSortRange(T* data, std::size_t n) {
+    for (std::size_t i = 1; i < n; ++i) {
+        T key = data[i];                             // Текущий элемент
+        std::size_t j = i;
+        while (j > 0 && key < data[j - 1]) {         // Сдвигаем большие элементы вправо
+            data[j] = data[j - 1];
+            --j;
+        }
+        data[j] = key;                               // Вставляем на своё место
+    }
+}
+
+// Параллельное устойчивое слияние a[0..na) и b[0..nb) в out (разделяй и властвуй по двоичному поиску);
+// слияния меньше cutoff выполняются последовательно
+template <typename T>
+void parallelMergeRange(const T* a, std::size_t na, const T* b, std::size_t nb, T* out,
+                        std::size_t cutoff = MERGE_TASK_CUTOFF) {
+    if (na + nb < cutoff || na + nb <= SORT_INSERTION_CUTOFF) { // Маленькое слияние — последовательно
+        std::merge(a, a + na, b, b + nb, out);
+        return;
+    }
+    std::size_t ma, mb;                              // Точки разреза в a и b
+    if (na >= nb) {                                  // Делим больший массив пополам
+        ma = na / 2;
+        mb = std::lower_bound(b, b + nb, a[ma]) - b; // Элементы b, строго меньшие a[ma], идут влево
+    } else {
+        mb = nb / 2;
+        ma = std::upper_bound(a, a + na, b[mb]) - a; // Элементы a, не большие b[mb], идут влево (устойчивость)
+    }
+    #pragma omp task default(none) firstprivate(a, b, out, ma, mb, cutoff)
+    parallelMergeRange(a, ma, b, mb, out, cutoff);   // Левая половина результата
+    parallelMergeRange(a + ma, na - ma, b + mb, nb - mb, out + ma + mb, cutoff); // Правая половина — в текущей задаче
+    #pragma omp taskwait
+}
+
+// Рекурсивная сортировка слиянием: src[0..n) сортируется, результат в src (resultInTmp = false) или в tmp;
+// куски от taskCutoff делятся на задачи, слияния от 2 * taskCutoff — параллельные
+template <typename T>
+void mergeSortTask(T* src, T* tmp, std::size_t n, bool resultInTmp, std::size_t taskCutoff) {
+    if (n <= SORT_INSERTION_CUTOFF) {                // Маленький кусок — вставками
+        insertionSortRange(src, n);
+        if (resultInTmp) std::copy(src, src + n, tmp);
+        return;
+    }
+    std::size_t mid = n / 2;                         // Середина куска
+    if (n >= taskCutoff) {                           // Большой кусок — половины как отдельные задачи
+        #pragma omp task default(none) firstprivate(src, tmp, mid, resultInTmp, taskCutoff)
+        mergeSortTask(src, tmp, mid, !resultInTmp, taskCutoff);
+        mergeSortTask(src + mid, tmp + mid, n - mid, !resultInTmp, taskCutoff);
+        #pragma omp taskwait
+    } else {
+        mergeSortTask(src, tmp, mid, !resultInTmp, taskCutoff);
+        mergeSortTask(src + mid, tmp + mid, n - mid, !resultInTmp, taskCutoff);
+    }
+    // Половины лежат в другом буфере — сливаем их в нужный
+    const T* from = resultInTmp ? src : tmp;
+    T* to = resultInTmp ? tmp : src;
+    if (n >= taskCutoff) {
+        parallelMergeRange(from, mid, from + mid, n - mid, to, 2 * taskCutoff);
+    } else {
+        std::merge(from, from + mid, from + mid, from + n, to);
+    }
+}
+
+// Параллельная сортировка слиянием (устойчивая)
+// taskCutoff — размер куска, ниже которого задачи не порождаются; массив меньше taskCutoff сортируется без команды
+// потоков (меньший порог — для калибровки dispatch.h на маленьких массивах, как sequentialCutoff у parallelReduce)
+template <typename T>
+void parallelMergeSort(T* data, std::size_t n, std::size_t taskCutoff = SORT_TASK_CUTOFF) {
+    if (n < 2) return;
+    if (taskCutoff < SORT_INSERTION_CUTOFF) taskCutoff = SORT_INSERTION_CUTOFF;
+    ScratchArray<T> tmp(n);                          // Временный буфер того же размера (из арены потока)
+
+    #pragma omp parallel if (n >= taskCutoff)
+    #pragma omp single nowait                        // Один поток порождает задачи, остальные их выполняют
+    mergeSortTask(data, tmp.data(), n, false, taskCutoff);
+}
+
+template <typename T>
+void parallelMergeSort(std::vector<T>& arr, std::size_t taskCutoff = SORT_TASK_CUTOFF) {
+    parallelMergeSort(arr.data(), arr.size(), taskCutoff);
+}
+
+// Параллельная сортировка выборкой (samplesort)
+// sequentialCutoff — размер, ниже которого сортирует std::sort; выше, но при нехватке элементов для выборки
+// корзин становится меньше (не меньше двух на поток), чтобы калибровка dispatch.h мерила параллельный путь
+template <typename T>
+void parallelSampleSort(T* data, std::size_t n, std::size_t sequentialCutoff = SORT_TASK_CUTOFF) {
+    int maxThreads = omp_get_max_threads();          // Количество потоков
+    std::size_t buckets = static_cast<std::size_t>(maxThreads) * SAMPLE_SORT_BUCKETS_PER_THREAD;
+    while (buckets > 2 * static_cast<std::size_t>(maxThreads) && n < buckets * SAMPLE_SORT_OVERSAMPLING * 4) {
+        buckets /= 2;
+    }
+    if (maxThreads == 1 || n < sequentialCutoff || n < buckets * SAMPLE_SORT_OVERSAMPLING * 4) {
+        std::sort(data, data + n);                   // Маленький массив или один поток — обычная сортировка
+        return;
+    }
+
+    // 1. Выборка: равномерно расставленные образцы, сортируем и берём каждый OVERSAMPLING-й.
+    //    Образец — пара (значение, позиция): при повторяющихся ключах разделители с одним значением
+    //    отличаются позицией, и равные ключи расходятся по нескольким корзинам, а не падают в одну
+    std::size_t sampleCount = buckets * SAMPLE_SORT_OVERSAMPLING;
+    std::vector<std::pair<T, std::size_t>> sample(sampleCount);
+    for (std::size_t s = 0; s < sampleCount; ++s) {
+        std::size_t pos = (s * (n / sampleCount)) + (s * 7919) % (n / sampleCount); // Шаг + сдвиг внутри шага
+        sample[s] = {data[pos], pos};
+    }
+    std::sort(sample.begin(), sample.end());
+    std::vector<T> splitters(buckets - 1);           // buckets - 1 разделителей: значения
+    std::vector<std::size_t> splitterPos(buckets - 1); // и позиции (для равных значений — по возрастанию)
+    for (std::size_t b = 1; b < buckets; ++b) {
+        splitters[b - 1] = sample[b * SAMPLE_SORT_OVERSAMPLING].first;
+        splitterPos[b - 1] = sample[b * SAMPLE_SORT_OVERSAMPLING].second;
+    }
+
+    // Номер корзины элемента data[i]: первый разделитель, строго больший пары (x, i)
+    auto bucketOf = [&splitters, &splitterPos](const T& x, std::size_t i) {
+        auto hi = std::upper_bound(splitters.begin(), splitters.end(), x);
+        auto lo = std::lower_bound(splitters.begin(), hi, x);
+        if (lo != hi) {                              // x совпадает с разделителями [lo, hi) — решает позиция
+            std::size_t first = static_cast<std::size_t>(lo - splitters.begin());
+            std::size_t last = static_cast<std::size_t>(hi - splitters.begin());
+            return static_cast<std::size_t>(std::upper_bound(splitterPos.begin() + first, splitterPos.begin() + last, i) -
+                                            splitterPos.begin());
+        }
+        return static_cast<std::size_t>(hi - splitters.begin());
+    };
+
+    std::vector<std::size_t> counts;                 // counts[t * buckets + b] — элементы потока t в корзине b
+    std::vector<std::size_t> bucketStart(buckets + 1, 0); // Начало каждой корзины в выходном массиве
+    ScratchArray<T> out(n);                          // Буфер распределения (из арены потока)
+
+    #pragma omp parallel
+    {
+        int tid = omp_get_thread_num();
+        int nthreads = omp_get_num_threads();
+        #pragma omp single
+        {
+            counts.assign(static_cast<std::size_t>(nthreads) * buckets, 0);
+        }                                            // Неявный барьер после single
+
+        std::size_t begin, end;
+        threadRange(n, tid, nthreads, begin, end);   // Свой кусок входного массива
+        std::size_t* myCounts = &counts[static_cast<std::size_t>(tid) * buckets];
+
+        // 2. Гистограмма потока
+        for (std::size_t i = begin; i < end; ++i) {
+            ++myCounts[bucketOf(data[i], i)];
+        }
+        #pragma omp barrier
+
+        // 3. Префиксные суммы: порядок (корзина, поток) — элементы корзины от потоков идут подряд
+        #pragma omp single
+        {
+            std::size_t offset = 0;
+            for (std::size_t b = 0; b < buckets; ++b) {
+                bucketStart[b] = offset;
+                for (int t = 0; t < nthreads; ++t) {
+                    std::size_t c = counts[static_cast<std::size_t>(t) * buckets + b];
+                    counts[static_cast<std::size_t>(t) * buckets + b] = offset; // Теперь это позиция записи
+                    offset += c;
+                }
+            }
+            bucketStart[buckets] = offset;
+        }
+
+        // 4. Распределение элементов по корзинам
+        for (std::size_t i = begin; i < end; ++i) {
+            out[myCounts[bucketOf(data[i], i)]++] = data[i];
+        }
+        #pragma omp barrier
+
+        // 5. Каждая корзина сортируется независимо и копируется обратно
+        #pragma omp for schedule(dynamic, 1)
+        for (std::size_t b = 0; b < buckets; ++b) {
+            T* first = out.data() + bucketStart[b];
+            T* last = out.data() + bucketStart[b + 1];
+            std::sort(first, last);
+            std::copy(first, last, data + bucketStart[b]);
+        }
+    }
+}
+
+template <typename T>
+void parallelSampleSort(std::vector<T>& arr, std::size_t sequentialCutoff = SORT_TASK_CUTOFF) {
+    parallelSampleSort(arr.data(), arr.size(), sequentialCutoff);
+}
@@ -0,0 +1,265 @@
+// Общая библиотека: редукции и сортировки на постоянном пуле потоков (thread_pool.h)
+// Те же алгоритмы, что в reduction.h и parallel_sort.h, но без новой области #pragma omp parallel на каждый вызов:
+// задачи выполняют потоки ThreadPool::global(), а рекурсия (сортировка слиянием, быстрая сортировка из
+// Practice3task4) порождает задачи через TaskGroup::spawn / sync без вложенных областей.
+//   - poolReduce / poolSum / poolMinMax / poolArgMin — parallelReduce пула с reduceRange / argMinRange в листьях;
+//   - poolMergeSort — сортировка слиянием с ping-pong буферами и параллельным слиянием, как parallelMergeSort;
+//   - poolPartition — параллельное разбиение на месте по блокам: потоки берут блоки с левого и правого краёв
+//     и обменивают элементы между ними, пока блок не станет "чистым"; остаток в середине разбивается одним потоком;
+//   - poolQuickSort — быстрая сортировка: опорный — псевдомедиана девяти, трёхчастное разбиение (большие куски —
+//     poolPartition на всех потоках), левая часть — задачей, правая — в текущем потоке,
+//     при слишком глубокой рекурсии (плохие опорные элементы) — std::sort (introsort).
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <vector>        // Для временного буфера
+#include <utility>       // Для pair
+#include <algorithm>     // Для sort, merge, partition, swap_ranges, lower_bound, upper_bound
+#include <atomic>        // Для счётчиков блоков разбиения
+#include "thread_pool.h"     // Для ThreadPool / TaskGroup
+#include "reduction.h"       // Для reduceRange / argMinRange / mergeReduction
+#include "parallel_sort.h"   // Для insertionSortRange и порогов сортировки
+#include "arena.h"           // Для ScratchArray
+
+const std::size_t POOL_REDUCE_GRAIN = 1 << 16;         // Наименьший кусок редукции (меньше — задачи дороже работы)
+const std::size_t POOL_TASKS_PER_THREAD = 4;           // Кусков редукции на поток (для балансировки)
+const std::size_t POOL_PARTITION_BLOCK = 1 << 12;      // Блок параллельного разбиения (элементов)
+const std::size_t POOL_PARTITION_CUTOFF = 1 << 18;     // Меньшие куски разбиваются std::partition в одном потоке
+
+// Размер куска редукции: не меньше POOL_REDUCE_GRAIN и около POOL_TASKS_PER_THREAD кусков на поток
+inline std::size_t poolReduceGrain(std::size_t n, const ThreadPool& pool) {
+    std::size_t grain = n / (pool.size() * POOL_TASKS_PER_THREAD);
+    return grain < POOL_REDUCE_GRAIN ? POOL_REDUCE_GRAIN : grain;
+}
+
+// Совмещённая редукция: min, max, сумма и количество
+template <typename T>
+ReductionResult<T> poolReduce(const T* data, std::size_t n, ThreadPool& pool = ThreadPool::global()) {
+    if (n < REDUCTION_SEQUENTIAL_CUTOFF || pool.size() == 1) return reduceRange(data, 0, n);
+    return pool.parallelReduce(
+        0, n, poolReduceGrain(n, pool), ReductionResult<T>(),
+        [data](std::size_t b, std::size_t e) { return reduceRange(data, b, e); },
+        [](ReductionResult<T> left, const ReductionResult<T>& right) { mergeReduction(left, right); return left; });
+}
+
+template <typename T>
+SumType<T> poolSum(const T* data, std::size_t n, ThreadPool& pool = ThreadPool::global()) {
+    return poolReduce(data, n, pool).sum;
+}
+
+template <typename T>
+std::pair<T, T> poolMinMax(const T* data, std::size_t n, ThreadPool& pool = ThreadPool::global()) {
+    ReductionResult<T> r = poolReduce(data, n, pool);
+    return std::make_pair(r.minValue, r.maxValue);
+}
+
+// Индекс первого минимального элемента (0 для пустого массива)
+template <typename T>
+std::size_t poolArgMin(const T* data, std::size_t n, ThreadPool& pool = ThreadPool::global()) {
+    if (n == 0) return 0;
+    typedef std::pair<T, std::size_t> Candidate;                       // Значение и индекс; индекс n — пусто
+    Candidate best = pool.parallelReduce(
+        0, n, poolReduceGrain(n, pool), Candidate(T(), n),
+        [data](std::size_t b, std::size_t e) {
+            Candidate c;
+            argMinRange(data, b, e, c.first, c.second);
+            return c;
+        },
+        [n](const Candidate& left, const Candidate& right) {           // Левый кусок раньше — при равенстве он
+            if (left.second == n) return right;
+            if (right.second == n) return left;
+            return right.first < left.first ? right : left;
+        });
+    return best.second;
+}
+
+// Параллельное устойчивое слияние (как parallelMergeRange, но задачами пула)
+template <typename T>
+void poolMergeRange(ThreadPool& pool, const T* a, std::size_t na, const T* b, std::size_t nb, T* out) {
+    if (na + nb < MERGE_TASK_CUTOFF) {
+        std::merge(a, a + na, b, b + nb, out);
+        return;
+    }
+    std::size_t ma, mb;
+    if (na >= nb) {
+        ma = na / 2;
+        mb = std::lower_bound(b, b + nb, a[ma]) - b;
+    } else {
+        mb = nb / 2;
+        ma = std::upper_bound(a, a + na, b[mb]) - a;
+    }
+    TaskGroup group(pool);
+    group.spawn([&pool, a, b, out, ma, mb] { poolMergeRange(pool, a, ma, b, mb, out); });
+    poolMergeRange(pool, a + ma, na - ma, b + mb, nb - mb, out + ma + mb);
+    group.sync();
+}
+
+// Сортировка слиянием src[0..n); результат в src (resultInTmp = false) или в tmp
+template <typename T>
+void poolMergeSortTask(ThreadPool& pool, T* src, T* tmp, std::size_t n, bool resultInTmp) {
+    if (n <= SORT_INSERTION_CUTOFF) {
+        insertionSortRange(src, n);
+        if (resultInTmp) std::copy(src, src + n, tmp);
+        return;
+    }
+    std::size_t mid = n / 2;
+    if (n >= SORT_TASK_CUTOFF) {
+        TaskGroup group(pool);
+        group.spawn([&pool, src, tmp, mid, resultInTmp] { poolMergeSortTask(pool, src, tmp, mid, !resultInTmp); });
+        poolMergeSortTask(pool, src + mid, tmp + mid, n - mid, !resultInTmp);
+        group.sync();
+    } else {
+        poolMergeSortTask(pool, src, tmp, mid, !resultInTmp);
+        poolMergeSortTask(pool, src + mid, tmp + mid, n - mid, !resultInTmp);
+    }
+    const T* from = resultInTmp ? src : tmp;
+    T* to = resultInTmp ? tmp : src;
+    if (n >= SORT_TASK_CUTOFF) poolMergeRange(pool, from, mid, from + mid, n - mid, to);
+    else std::merge(from, from + mid, from + mid, from + n, to);
+}
+
+// Сортировка слиянием на пуле (устойчивая)
+template <typename T>
+void poolMergeSort(T* data, std::size_t n, ThreadPool& pool = ThreadPool::global()) {
+    if (n < 2) return;
+    ScratchArray<T> tmp(n);                          // Из арены вызывающего потока
+    poolMergeSortTask(pool, data, tmp.data(), n, false);
+}
+
+// Параллельное разбиение a[0..n) на месте: элементы с pred — в начало; возвращает их количество.
+// Левые блоки берутся с начала массива, правые — с конца (общий счётчик оставшихся блоков не даёт им пересечься).
+// Поток держит один левый и один правый блок: в левом пропускает элементы с pred, в правом — без pred и меняет
+// найденную пару местами. Закончившийся левый блок целиком из pred, правый — целиком без pred; тогда поток берёт
+// следующий. Недоделанные блоки (не больше одного левого и одного правого на поток) переставляются к середине
+// и вместе с ней разбиваются std::partition
+template <typename T, typename Pred>
+std::size_t poolPartition(ThreadPool& pool, T* a, std::size_t n, Pred pred) {
+    const std::size_t B = POOL_PARTITION_BLOCK;
+    std::size_t blocks = n / B;
+    int workers = static_cast<int>(std::min<std::size_t>(pool.size(), blocks / 4));   // Не меньше 4 блоков на поток
+    if (n < POOL_PARTITION_CUTOFF || workers < 2) return std::partition(a, a + n, pred) - a;
+
+    const std::size_t NONE = static_cast<std::size_t>(-1);
+    std::atomic<std::ptrdiff_t> remaining(static_cast<std::ptrdiff_t>(blocks));
+    std::atomic<std::size_t> leftTaken(0), rightTaken(0);
+    std::vector<std::size_t> leftOpen(workers, NONE), rightOpen(workers, NONE);   // Недоделанные блоки потоков
+
+    auto worker = [&](int w) {
+        std::size_t l = NONE, r = NONE;                                // Номера блоков (правые — от конца)
+        std::size_t i = 0, j = 0;                                      // Позиции внутри блоков
+        while (true) {
+            if (l == NONE) {
+                if (remaining.fetch_sub(1) <= 0) break;
+                l = leftTaken.fetch_add(1);
+                i = 0;
+            }
+            if (r == NONE) {
+                if (remaining.fetch_sub(1) <= 0) break;
+                r = rightTaken.fetch_add(1);
+                j = 0;
+            }
+            T* left = a + l * B;
+            T* right = a + n - (r + 1) * B;
+            while (true) {
+                while (i < B && pred(left[i])) ++i;
+                while (j < B && !pred(right[j])) ++j;
+                if (i == B || j == B) break;
+                std::swap(left[i++], right[j++]);
+            }
+            if (i == B) l = NONE;                                      // Левый блок чист
+            if (j == B) r = NONE;                                      // Правый блок чист
+        }
+        leftOpen[w] = l;
+        rightOpen[w] = r;
+    };
+    TaskGroup group(pool);
+    for (int w = 1; w < workers; ++w) group.spawn([&worker, w] { worker(w); });
+    worker(0);
+    group.sync();
+
+    // Недоделанные блоки меняются местами с чистыми блоками у границы, чтобы чистые шли подряд от краёв;
+    // возвращает число чистых блоков стороны
+    auto gather = [&](const std::vector<std::size_t>& open, std::size_t taken, bool leftSide) {
+        auto block = [&](std::size_t k) { return leftSide ? a + k * B : a + n - (k + 1) * B; };
+        std::vector<bool> isOpen(taken, false);
+        std::size_t count = 0;
+        for (std::size_t k : open) {
+            if (k != NONE) {
+                isOpen[k] = true;
+                ++count;
+            }
+        }
+        std::size_t border = taken - count;                            // Блоки [border, taken) уйдут в середину
+        std::size_t clean = border;                                    // Чистый блок за границей для обмена
+        for (std::size_t k = 0; k < border; ++k) {
+            if (!isOpen[k]) continue;
+            while (isOpen[clean]) ++clean;
+            std::swap_ranges(block(k), block(k) + B, block(clean));
+            ++clean;
+        }
+        return border;
+    };
+    std::size_t middleBegin = gather(leftOpen, leftTaken.load(), true) * B;
+    std::size_t middleEnd = n - gather(rightOpen, rightTaken.load(), false) * B;
+    return std::partition(a + middleBegin, a + middleEnd, pred) - a;
+}
+
+// Псевдомедиана девяти (медиана трёх медиан трёх) — опорный элемент, устойчивый к упорядоченным данным
+template <typename T>
+T medianOf3(const T& x, const T& y, const T& z) {
+    return x < y ? (y < z ? y : (x < z ? z : x)) : (x < z ? x : (y < z ? z : y));
+}
+
+template <typename T>
+T pseudoMedian9(const T* a, std::size_t n) {
+    std::size_t s = n / 8;
+    return medianOf3(medianOf3(a[0], a[s], a[2 * s]),
+                     medianOf3(a[3 * s], a[n / 2], a[5 * s]),
+                     medianOf3(a[6 * s], a[7 * s], a[n - 1]));
+}
+
+// Быстрая сортировка a[0..n): depth — сколько ещё уровней разрешено до перехода на std::sort
+template <typename T>
+void poolQuickSortTask(ThreadPool& pool, T* a, std::size_t n, int depth) {
+    if (n < SORT_TASK_CUTOFF || depth == 0) {                          // Маленький кусок или плохие опорные
+        std::sort(a, a + n);
+        return;
+    }
+    T pivot = pseudoMedian9(a, n);
+    std::size_t left = poolPartition(pool, a, n, [&pivot](const T& v) { return v < pivot; });
+    std::size_t equal = poolPartition(pool, a + left, n - left, [&pivot](const T& v) { return !(pivot < v); });
+    T* rightBegin = a + left + equal;                                  // Равные опорному уже на месте
+
+    TaskGroup group(pool);
+    group.spawn([&pool, a, left, depth] { poolQuickSortTask(pool, a, left, depth - 1); });
+    poolQuickSortTask(pool, rightBegin, (a + n) - rightBegin, depth - 1);   // Правая часть — в текущем потоке
+    group.sync();
+}
+
+// Быстрая сортировка на пуле (неустойчивая)
+template <typename T>
+void poolQuickSort(T* data, std::size_t n, ThreadPool& pool = ThreadPool::global()) {
+    int depth = 0;
+    for (std::size_t m = n; m > 1; m /= 2) depth += 2;                 // 2 log2(n), как в introsort
+    poolQuickSortTask(pool, data, n, depth);
+}
+
+// Перегрузки для vector
+template <typename T>
+ReductionResult<T> poolReduce(const std::vector<T>& v) { return poolReduce(v.data(), v.size()); }
+
+template <typename T>
+SumType<T> poolSum(const std::vector<T>& v) { return poolSum(v.data(), v.size()); }
+
+template <typename T>
+std::pair<T, T> poolMinMax(const std::vector<T>& v) { return poolMinMax(v.data(), v.size()); }
+
+template <typename T>
+std::size_t poolArgMin(const std::vector<T>& v) { return poolArgMin(v.data(), v.size()); }
+
+template <typename T>
+void poolMergeSort(std::vector<T>& v) { poolMergeSort(v.data(), v.size()); }
+
+template <typename T>
+void poolQuickSort(std::vector<T>& v) { poolQuickSort(v.data(), v.size()); }
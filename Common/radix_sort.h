@@ -0,0 +1,174 @@
+// Общая библиотека: параллельная поразрядная сортировка (LSD radix sort) 32-битных целых ключей
+// Все данные в программах — int из uniform_int_distribution, поэтому сравнения не нужны:
+//   - ключ делится на 4 разряда по 8 бит, каждый проход — устойчивое распределение по 256 корзинам;
+//   - каждый поток считает гистограмму своего куска, префиксные суммы дают поток-локальные позиции записи;
+//   - запись идёт через буферы write-combining: по 16 ключей (одна кэш-линия) на корзину,
+//     в память уходят целые строки, а не отдельные элементы вразброс;
+//   - гистограммы всех разрядов считаются заранее одним проходом: если все ключи имеют одинаковый
+//     разряд (например, старший байт у чисел 0..99999), этот проход пропускается;
+//   - radixSortPairs переставляет вместе с ключами массив значений (сортировка пар ключ/значение).
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <cstdint>       // Для uint32_t
+#include <cstring>       // Для memcpy
+#include <vector>        // Для перегрузок с vector
+#include <type_traits>   // Для проверок типа ключа
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"   // Для threadRange
+#include "arena.h"       // Для ScratchArray (буферы и гистограммы из арены потока)
+
+const int RADIX_BITS = 8;                              // Бит в одном разряде
+const std::size_t RADIX_BUCKETS = 1 << RADIX_BITS;     // 256 корзин
+const int RADIX_PASSES = 32 / RADIX_BITS;              // 4 прохода для 32-битного ключа
+const std::size_t RADIX_WC_SIZE = 16;                  // Элементов в буфере write-combining (64 байта для int)
+const std::size_t RADIX_SEQUENTIAL_CUTOFF = 1 << 16;   // Ниже этого размера сортирует один поток
+
+// Беззнаковое представление ключа с сохранением порядка (у знаковых инвертируется знаковый бит)
+template <typename K>
+inline std::uint32_t radixKey(K key) {
+    static_assert(std::is_integral<K>::value && sizeof(K) == 4, "radix sort: нужен 32-битный целый ключ");
+    std::uint32_t u = static_cast<std::uint32_t>(key);
+    return std::is_signed<K>::value ? (u ^ 0x80000000u) : u;
+}
+
+// Пустой тип значения для сортировки только ключей
+struct RadixNoValue {};
+
+// Общая реализация: keys (и values, если WithValues) сортируются, tmpKeys / tmpValues — буферы того же размера
+template <typename K, typename V, bool WithValues>
+void radixSortImpl(K* keys, V* values, std::size_t n, K* tmpKeys, V* tmpValues) {
+    if (n < 2) return;
+
+    int maxThreads = omp_get_max_threads();
+    const std::size_t totalsSize = RADIX_PASSES * RADIX_BUCKETS;                         // Счётчиков во всех разрядах
+    ScratchArray<std::size_t> digitTotals(totalsSize);                                   // Глобальные гистограммы разрядов
+    ScratchArray<std::size_t> threadTotals(static_cast<std::size_t>(maxThreads) * totalsSize); // Гистограммы разрядов потоков
+    ScratchArray<std::size_t> threadCounts(static_cast<std::size_t>(maxThreads) * RADIX_BUCKETS); // Гистограмма / позиции потоков
+
+    #pragma omp parallel if (n >= RADIX_SEQUENTIAL_CUTOFF)
+    {
+        int tid = omp_get_thread_num();
+        int nthreads = omp_get_num_threads();
+        std::size_t begin, end;
+        threadRange(n, tid, nthreads, begin, end);                     // Кусок потока (одинаковый во всех проходах)
+
+        // Гистограммы всех разрядов одним чтением (для пропуска одинаковых разрядов)
+        std::size_t* localTotals = &threadTotals[static_cast<std::size_t>(tid) * totalsSize];
+        for (std::size_t b = 0; b < totalsSize; ++b) localTotals[b] = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            std::uint32_t u = radixKey(keys[i]);
+            for (int p = 0; p < RADIX_PASSES; ++p) {
+                ++localTotals[p * RADIX_BUCKETS + ((u >> (p * RADIX_BITS)) & (RADIX_BUCKETS - 1))];
+            }
+        }
+        #pragma omp barrier
+        #pragma omp for                                                // Сумма гистограмм потоков, по счётчикам
+        for (std::size_t b = 0; b < totalsSize; ++b) {
+            std::size_t sum = 0;
+            for (int t = 0; t < nthreads; ++t) sum += threadTotals[static_cast<std::size_t>(t) * totalsSize + b];
+            digitTotals[b] = sum;
+        }                                                              // Неявный барьер
+
+        ScratchArray<K> wcKeys(RADIX_BUCKETS * RADIX_WC_SIZE);         // Буферы write-combining ключей (по кэш-линии)
+        ScratchArray<V> wcValues(WithValues ? RADIX_BUCKETS * RADIX_WC_SIZE : 0); // И значений
+        std::size_t wcFill[RADIX_BUCKETS];                             // Заполненность буферов
+
+        K* src = keys;                                                 // Откуда читаем в текущем проходе
+        K* dst = tmpKeys;                                              // Куда пишем
+        V* srcV = values;
+        V* dstV = tmpValues;
+        std::size_t* myPos = &threadCounts[static_cast<std::size_t>(tid) * RADIX_BUCKETS];
+
+        for (int p = 0; p < RADIX_PASSES; ++p) {
+            int shift = p * RADIX_BITS;
+            bool trivial = false;                                      // Все ключи в одной корзине — проход не нужен
+            for (std::size_t b = 0; b < RADIX_BUCKETS; ++b) {
+                if (digitTotals[p * RADIX_BUCKETS + b] == n) trivial = true;
+            }
+            if (trivial) continue;                                     // Решение одинаково во всех потоках
+
+            // 1. Гистограмма своего куска по текущему разряду
+            for (std::size_t b = 0; b < RADIX_BUCKETS; ++b) myPos[b] = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                ++myPos[(radixKey(src[i]) >> shift) & (RADIX_BUCKETS - 1)];
+            }
+            #pragma omp barrier
+
+            // 2. Префиксные суммы в порядке (корзина, поток): элементы корзины от потоков идут подряд
+            #pragma omp single
+            {
+                std::size_t offset = 0;
+                for (std::size_t b = 0; b < RADIX_BUCKETS; ++b) {
+                    for (int t = 0; t < nthreads; ++t) {
+                        std::size_t& c = threadCounts[static_cast<std::size_t>(t) * RADIX_BUCKETS + b];
+                        std::size_t count = c;
+                        c = offset;                                    // Позиция записи потока t в корзине b
+                        offset += count;
+                    }
+                }
+            }                                                          // Неявный барьер
+
+            // 3. Распределение через буферы write-combining
+            for (std::size_t b = 0; b < RADIX_BUCKETS; ++b) wcFill[b] = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                K k = src[i];
+                std::size_t b = (radixKey(k) >> shift) & (RADIX_BUCKETS - 1);
+                std::size_t slot = b * RADIX_WC_SIZE + wcFill[b];
+                wcKeys[slot] = k;
+                if constexpr (WithValues) wcValues[slot] = srcV[i];
+                if (++wcFill[b] == RADIX_WC_SIZE) {                    // Буфер полон — одна запись строкой
+                    std::memcpy(dst + myPos[b], &wcKeys[b * RADIX_WC_SIZE], RADIX_WC_SIZE * sizeof(K));
+                    if constexpr (WithValues) {
+                        for (std::size_t j = 0; j < RADIX_WC_SIZE; ++j) dstV[myPos[b] + j] = wcValues[b * RADIX_WC_SIZE + j];
+                    }
+                    myPos[b] += RADIX_WC_SIZE;
+                    wcFill[b] = 0;
+                }
+            }
+            for (std::size_t b = 0; b < RADIX_BUCKETS; ++b) {          // Сброс неполных буферов
+                for (std::size_t j = 0; j < wcFill[b]; ++j) {
+                    dst[myPos[b] + j] = wcKeys[b * RADIX_WC_SIZE + j];
+                    if constexpr (WithValues) dstV[myPos[b] + j] = wcValues[b * RADIX_WC_SIZE + j];
+                }
+            }
+            #pragma omp barrier                                        // Проход закончен у всех потоков
+
+            std::swap(src, dst);                                       // Следующий проход читает результат этого
+            std::swap(srcV, dstV);
+        }
+
+        if (src != keys) {                                             // Нечётное число проходов — копируем обратно
+            std::memcpy(keys + begin, src + begin, (end - begin) * sizeof(K));
+            if constexpr (WithValues) {
+                for (std::size_t i = begin; i < end; ++i) values[i] = srcV[i];
+            }
+        }
+    }
+}
+
+// Параллельная поразрядная сортировка 32-битных целых ключей
+template <typename K>
+void radixSortParallel(K* keys, std::size_t n) {
+    ScratchArray<K> tmp(n);                                            // Буфер для чередования проходов
+    radixSortImpl<K, RadixNoValue, false>(keys, nullptr, n, tmp.data(), nullptr);
+}
+
+template <typename K>
+void radixSortParallel(std::vector<K>& keys) {
+    radixSortParallel(keys.data(), keys.size());
+}
+
+// Сортировка пар ключ/значение: values[i] остаётся привязанным к keys[i], порядок равных ключей сохраняется
+template <typename K, typename V>
+void radixSortPairs(K* keys, V* values, std::size_t n) {
+    ScratchArray<K> tmpKeys(n);
+    ScratchArray<V> tmpValues(n);
+    radixSortImpl<K, V, true>(keys, values, n, tmpKeys.data(), tmpValues.data());
+}
+
+template <typename K, typename V>
+void radixSortPairs(std::vector<K>& keys, std::vector<V>& values) {
+    radixSortPairs(keys.data(), values.data(), keys.size());
+}
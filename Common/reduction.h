@@ -0,0 +1,242 @@
+// Общая библиотека: параллельные редукции (sum / min / max / minmax / mean / argmin)
+// Одна реализация вместо копий циклов из Assignment_1, Assignment_2 и Practice1:
+//   - один проход по памяти считает сразу min, max и сумму (fused pass);
+//   - каждый поток работает со своим непрерывным куском массива;
+//   - внутри потока несколько независимых аккумуляторов (компилятор превращает их в SIMD-регистры);
+//   - частичные результаты потоков лежат в отдельных кэш-линиях (нет false sharing);
+//   - слияние частичных результатов без omp critical, одним потоком после параллельной области.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <limits>        // Для numeric_limits (начальные значения min/max)
+#include <type_traits>   // Для выбора типа аккумулятора суммы
+#include <vector>        // Для хранения частичных результатов потоков
+#include <utility>       // Для pair
+#include <omp.h>         // Для OpenMP
+
+const std::size_t CACHE_LINE_SIZE = 64;                  // Размер кэш-линии в байтах (x86 / ARM)
+const std::size_t REDUCTION_LANES = 8;                   // Количество независимых аккумуляторов в потоке
+const std::size_t REDUCTION_SEQUENTIAL_CUTOFF = 1 << 15; // Ниже этого размера потоки не запускаются
+const std::size_t ARGMIN_BLOCK = 256;                    // Размер блока в поиске индекса минимума
+
+// Тип суммы: целые суммируются в 64 бита (int переполняется уже на 5 000 000 элементах), дробные — в double
+template <typename T>
+using SumType = typename std::conditional<
+    std::is_floating_point<T>::value, double,
+    typename std::conditional<std::is_signed<T>::value, long long, unsigned long long>::type>::type;
+
+// Результат совмещённого прохода
+template <typename T>
+struct ReductionResult {
+    T minValue = std::numeric_limits<T>::max();      // Минимум (для пустого массива остаётся max())
+    T maxValue = std::numeric_limits<T>::lowest();   // Максимум (для пустого массива остаётся lowest())
+    SumType<T> sum = 0;                              // Сумма всех элементов
+    std::size_t count = 0;                           // Количество обработанных элементов
+
+    double mean() const {                            // Среднее значение
+        return count == 0 ? 0.0 : static_cast<double>(sum) / count;
+    }
+};
+
+// Частичный результат одного потока, выровнен по кэш-линии
+template <typename T>
+struct alignas(CACHE_LINE_SIZE) ReductionPartial {
+    ReductionResult<T> value;                        // Локальные min / max / sum потока
+};
+
+// Частичный результат argmin одного потока
+template <typename T>
+struct alignas(CACHE_LINE_SIZE) ArgMinPartial {
+    T value = std::numeric_limits<T>::max();         // Локальный минимум
+    std::size_t index = 0;                           // Индекс первого вхождения локального минимума
+    bool found = false;                              // Поток получил непустой диапазон
+};
+
+// Границы куска массива для потока tid из nthreads (статическое разбиение, как schedule(static))
+inline void threadRange(std::size_t n, int tid, int nthreads, std::size_t& begin, std::size_t& end) {
+    std::size_t base = n / nthreads;                 // Базовый размер куска
+    std::size_t extra = n % nthreads;                // Первые extra потоков получают на 1 элемент больше
+    begin = tid * base + (static_cast<std::size_t>(tid) < extra ? tid : extra);
+    end = begin + base + (static_cast<std::size_t>(tid) < extra ? 1 : 0);
+}
+
+// Последовательная редукция куска [begin, end) с REDUCTION_LANES аккумуляторами
+template <typename T>
+ReductionResult<T> reduceRange(const T* data, std::size_t begin, std::size_t end) {
+    ReductionResult<T> result;                       // Итог куска
+    result.count = end - begin;                      // Количество элементов куска
+
+    T mn[REDUCTION_LANES];                           // Минимумы по дорожкам
+    T mx[REDUCTION_LANES];                           // Максимумы по дорожкам
+    SumType<T> s[REDUCTION_LANES];                   // Суммы по дорожкам
+    for (std::size_t l = 0; l < REDUCTION_LANES; ++l) {
+        mn[l] = result.minValue;
+        mx[l] = result.maxValue;
+        s[l] = 0;
+    }
+
+    std::size_t i = begin;
+    for (; i + REDUCTION_LANES <= end; i += REDUCTION_LANES) {   // Основной цикл: дорожки независимы → векторизуется
+        for (std::size_t l = 0; l < REDUCTION_LANES; ++l) {
+            T x = data[i + l];
+            mn[l] = x < mn[l] ? x : mn[l];           // Безветвленный минимум
+            mx[l] = x > mx[l] ? x : mx[l];           // Безветвленный максимум
+            s[l] += x;                               // Сумма в широком типе
+        }
+    }
+    for (; i < end; ++i) {                           // Хвост, не кратный REDUCTION_LANES
+        T x = data[i];
+        mn[0] = x < mn[0] ? x : mn[0];
+        mx[0] = x > mx[0] ? x : mx[0];
+        s[0] += x;
+    }
+
+    for (std::size_t l = 0; l < REDUCTION_LANES; ++l) {          // Сворачиваем дорожки
+        if (mn[l] < result.minValue) result.minValue = mn[l];
+        if (mx[l] > result.maxValue) result.maxValue = mx[l];
+        result.sum += s[l];
+    }
+    return result;
+}
+
+// Объединение двух частичных результатов
+template <typename T>
+void mergeReduction(ReductionResult<T>& into, const ReductionResult<T>& from) {
+    if (from.count == 0) return;                     // Пустой кусок ничего не меняет
+    if (from.minValue < into.minValue) into.minValue = from.minValue;
+    if (from.maxValue > into.maxValue) into.maxValue = from.maxValue;
+    into.sum += from.sum;
+    into.count += from.count;
+}
+
+// Совмещённый параллельный проход: min, max, сумма и количество за одно чтение массива
+// sequentialCutoff — размер, ниже которого потоки не запускаются (0 — всегда параллельно, для калибровки dispatch.h)
+template <typename T>
+ReductionResult<T> parallelReduce(const T* data, std::size_t n, std::size_t sequentialCutoff = REDUCTION_SEQUENTIAL_CUTOFF) {
+    static_assert(std::is_arithmetic<T>::value, "parallelReduce: нужен арифметический тип");
+
+    std::vector<ReductionPartial<T>> partials(omp_get_max_threads());   // По одной кэш-линии на поток
+    int usedThreads = 1;                                                // Фактический размер команды
+
+    #pragma omp parallel if (n >= sequentialCutoff)
+    {
+        int tid = omp_get_thread_num();              // Номер потока
+        int nthreads = omp_get_num_threads();        // Количество потоков в команде
+        std::size_t begin, end;
+        threadRange(n, tid, nthreads, begin, end);   // Свой непрерывный кусок
+        partials[tid].value = reduceRange(data, begin, end);
+        if (tid == 0) usedThreads = nthreads;
+    }
+
+    ReductionResult<T> result;                       // Слияние без critical: один поток, p шагов
+    for (int t = 0; t < usedThreads; ++t) {
+        mergeReduction(result, partials[t].value);
+    }
+    return result;
+}
+
+// Сумма элементов (64-битная для целых)
+template <typename T>
+SumType<T> parallelSum(const T* data, std::size_t n) {
+    return parallelReduce(data, n).sum;
+}
+
+// Минимум массива
+template <typename T>
+T parallelMin(const T* data, std::size_t n) {
+    return parallelReduce(data, n).minValue;
+}
+
+// Максимум массива
+template <typename T>
+T parallelMax(const T* data, std::size_t n) {
+    return parallelReduce(data, n).maxValue;
+}
+
+// Минимум и максимум за один проход
+template <typename T>
+std::pair<T, T> parallelMinMax(const T* data, std::size_t n) {
+    ReductionResult<T> r = parallelReduce(data, n);
+    return std::make_pair(r.minValue, r.maxValue);
+}
+
+// Среднее значение
+template <typename T>
+double parallelMean(const T* data, std::size_t n) {
+    return parallelReduce(data, n).mean();
+}
+
+// Первый минимум куска [begin, end), begin < end: значение в value, индекс в index
+// Минимум блока считается SIMD-редукцией; индекс ищется только в блоке, который улучшил минимум
+// (для случайных данных это происходит O(log n) раз), поэтому основной проход без ветвлений.
+template <typename T>
+void argMinRange(const T* data, std::size_t begin, std::size_t end, T& value, std::size_t& index) {
+    value = data[begin];                             // Начинаем с первого элемента куска (самый ранний индекс)
+    index = begin;
+    for (std::size_t b = begin; b < end; b += ARGMIN_BLOCK) {
+        std::size_t e = end - b < ARGMIN_BLOCK ? end : b + ARGMIN_BLOCK;
+        T blockMin = data[b];                        // Минимум блока
+        #pragma omp simd reduction(min:blockMin)
+        for (std::size_t i = b; i < e; ++i) {
+            blockMin = data[i] < blockMin ? data[i] : blockMin;
+        }
+        if (blockMin < value) {                      // Строго меньше — при равенстве остаётся первое вхождение
+            value = blockMin;
+            std::size_t i = b;
+            while (!(data[i] == blockMin)) ++i;      // Первое вхождение внутри блока
+            index = i;
+        }
+    }
+}
+
+// Индекс первого минимального элемента (0 для пустого массива)
+template <typename T>
+std::size_t parallelArgMin(const T* data, std::size_t n) {
+    static_assert(std::is_arithmetic<T>::value, "parallelArgMin: нужен арифметический тип");
+    if (n == 0) return 0;
+
+    std::vector<ArgMinPartial<T>> partials(omp_get_max_threads());
+    int usedThreads = 1;
+
+    #pragma omp parallel if (n >= REDUCTION_SEQUENTIAL_CUTOFF)
+    {
+        int tid = omp_get_thread_num();
+        int nthreads = omp_get_num_threads();
+        std::size_t begin, end;
+        threadRange(n, tid, nthreads, begin, end);
+
+        ArgMinPartial<T>& p = partials[tid];
+        p.found = begin < end;                       // Пустой кусок не участвует в слиянии
+        if (p.found) argMinRange(data, begin, end, p.value, p.index);
+        if (tid == 0) usedThreads = nthreads;
+    }
+
+    std::size_t best = n;                            // Слияние потоков
+    T bestValue = std::numeric_limits<T>::max();
+    for (int t = 0; t < usedThreads; ++t) {
+        const ArgMinPartial<T>& p = partials[t];
+        if (!p.found) continue;
+        if (best == n || p.value < bestValue || (p.value == bestValue && p.index < best)) {
+            bestValue = p.value;
+            best = p.index;
+        }
+    }
+    return best;
+}
+
+// Перегрузки для vector
+template <typename T>
+ReductionResult<T> parallelReduce(const std::vector<T>& v) { return parallelReduce(v.data(), v.size()); }
+
+template <typename T>
+SumType<T> parallelSum(const std::vector<T>& v) { return parallelSum(v.data(), v.size()); }
+
+template <typename T>
+std::pair<T, T> parallelMinMax(const std::vector<T>& v) { return parallelMinMax(v.data(), v.size()); }
+
+template <typename T>
+double parallelMean(const std::vector<T>& v) { return parallelMean(v.data(), v.size()); }
+
+template <typename T>
+std::size_t parallelArgMin(const std::vector<T>& v) { return parallelArgMin(v.data(), v.size()); }
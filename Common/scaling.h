@@ -0,0 +1,131 @@
+// Общая библиотека: исследование масштабируемости (strong / weak scaling) и точка окупаемости потоков
+// Программы использовали одно число потоков (по умолчанию OpenMP) и несколько жёстко заданных размеров,
+// а вывод "параллельная быстрее / медленнее" делался по одному замеру. Здесь собраны:
+//   - наборы точек для перебора: число потоков 1, 2, 4, ..., max и размеры через порядок величины;
+//   - ScalingPoint — одна точка замера (режим, ядро, потоки, размер, медианы, ускорение, эффективность);
+//   - аппроксимация законом Амдала (доля параллельной части по strong scaling) и законом Густафсона
+//     (доля последовательной части по weak scaling) методом наименьших квадратов;
+//   - поиск точки окупаемости: наименьший размер, начиная с которого параллельная версия быстрее
+//     последовательной на всех больших размерах — по нему выставляются *_SEQUENTIAL_CUTOFF.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <string>        // Для имён
+#include <vector>        // Для наборов точек
+#include <ostream>       // Для вывода
+#include <iostream>      // Для cout (имена файлов результатов)
+#include <iomanip>       // Для setw / setprecision
+#include "benchmark.h"   // Для writeResultFile
+
+// Одна точка исследования масштабируемости
+struct ScalingPoint {
+    std::string mode;                  // strong, weak или crossover
+    std::string kernel;                // Имя ядра
+    int threads = 1;                   // Потоков OpenMP
+    std::size_t n = 0;                 // Размер массива
+    double sequentialMs = 0;           // Медиана последовательного эталона (crossover) или 0
+    double parallelMs = 0;             // Медиана параллельной версии
+    double speedup = 1;                // strong: T(1)/T(p); weak: p * T(1)/T(p); crossover: T(seq)/T(par)
+    double efficiency = 1;             // speedup / threads
+};
+
+// Число потоков для перебора: степени двойки до maxThreads и сам maxThreads
+inline std::vector<int> threadSweep(int maxThreads) {
+    std::vector<int> counts;
+    for (int p = 1; p < maxThreads; p *= 2) counts.push_back(p);
+    counts.push_back(maxThreads);
+    return counts;
+}
+
+// Размеры для перебора: minN, 10 * minN, ... до maxN включительно
+inline std::vector<std::size_t> sizeSweep(std::size_t minN, std::size_t maxN) {
+    std::vector<std::size_t> sizes;
+    for (std::size_t n = minN; n <= maxN; n *= 10) {
+        sizes.push_back(n);
+        if (n > maxN / 10) break;                                      // Следующий шаг больше maxN (или переполнение)
+    }
+    return sizes;
+}
+
+// Закон Амдала: S(p) = 1 / ((1 - f) + f / p). Линейная форма 1 - 1/S = f * (1 - 1/p),
+// f — доля параллельной части; -1, если точек с p > 1 нет
+inline double fitAmdahl(const std::vector<ScalingPoint>& points) {
+    double sxy = 0, sxx = 0;
+    for (const ScalingPoint& pt : points) {
+        if (pt.threads < 2 || pt.speedup <= 0) continue;
+        double x = 1.0 - 1.0 / pt.threads;
+        double y = 1.0 - 1.0 / pt.speedup;
+        sxy += x * y;
+        sxx += x * x;
+    }
+    if (sxx == 0) return -1;
+    double f = sxy / sxx;
+    return f < 0 ? 0 : (f > 1 ? 1 : f);
+}
+
+// Закон Густафсона: S(p) = p - s * (p - 1), s — доля последовательной части; -1, если точек с p > 1 нет
+inline double fitGustafson(const std::vector<ScalingPoint>& points) {
+    double sxy = 0, sxx = 0;
+    for (const ScalingPoint& pt : points) {
+        if (pt.threads < 2) continue;
+        double x = pt.threads - 1.0;
+        double y = pt.threads - pt.speedup;
+        sxy += x * y;
+        sxx += x * x;
+    }
+    if (sxx == 0) return -1;
+    double s = sxy / sxx;
+    return s < 0 ? 0 : (s > 1 ? 1 : s);
+}
+
+// Точка окупаемости: наименьший n, начиная с которого speedup > 1 во всех точках (точки по возрастанию n);
+// 0 — параллельная версия не выигрывает даже на наибольшем размере
+inline std::size_t findCrossover(const std::vector<ScalingPoint>& points) {
+    std::size_t crossover = 0;
+    for (auto it = points.rbegin(); it != points.rend(); ++it) {       // С конца: пока параллельная выигрывает
+        if (it->speedup <= 1.0) break;
+        crossover = it->n;
+    }
+    return crossover;
+}
+
+// Таблица точек одного ядра
+inline void printScalingTable(const std::vector<ScalingPoint>& points, std::ostream& out) {
+    out << std::right << std::setw(6) << "thr" << std::setw(13) << "n" << std::setw(12) << "seq ms"
+        << std::setw(12) << "par ms" << std::setw(10) << "speedup" << std::setw(12) << "efficiency" << "\n";
+    for (const ScalingPoint& pt : points) {
+        out << std::setw(6) << pt.threads << std::setw(13) << pt.n << std::fixed << std::setprecision(4)
+            << std::setw(12) << pt.sequentialMs << std::setw(12) << pt.parallelMs << std::setprecision(2)
+            << std::setw(9) << pt.speedup << "x" << std::setw(11) << pt.efficiency * 100 << "%" << "\n";
+        out.unsetf(std::ios::fixed);
+    }
+}
+
+inline void writeScalingCsv(const std::vector<ScalingPoint>& points, std::ostream& out) {
+    out << "mode,kernel,threads,n,sequential_ms,parallel_ms,speedup,efficiency\n" << std::setprecision(6);
+    for (const ScalingPoint& pt : points) {
+        out << pt.mode << "," << pt.kernel << "," << pt.threads << "," << pt.n << "," << pt.sequentialMs << ","
+            << pt.parallelMs << "," << pt.speedup << "," << pt.efficiency << "\n";
+    }
+}
+
+inline void writeScalingJson(const std::vector<ScalingPoint>& points, std::ostream& out) {
+    out << "[\n" << std::setprecision(6);
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        const ScalingPoint& pt = points[i];
+        out << "  {\"mode\": \"" << pt.mode << "\", \"kernel\": \"" << pt.kernel << "\", \"threads\": " << pt.threads
+            << ", \"n\": " << pt.n << ", \"sequential_ms\": " << pt.sequentialMs << ", \"parallel_ms\": " << pt.parallelMs
+            << ", \"speedup\": " << pt.speedup << ", \"efficiency\": " << pt.efficiency << "}"
+            << (i + 1 < points.size() ? "," : "") << "\n";
+    }
+    out << "]\n";
+}
+
+// CSV и JSON точек по путям из командной строки (как writeResultFiles из benchmark.h для BenchmarkResult)
+inline bool writeResultFiles(const std::vector<ScalingPoint>& points, const std::string& csvPath,
+                             const std::string& jsonPath, std::ostream& out = std::cout) {
+    bool csv = writeResultFile(csvPath, "CSV", [&](std::ostream& file) { writeScalingCsv(points, file); }, out);
+    bool json = writeResultFile(jsonPath, "JSON", [&](std::ostream& file) { writeScalingJson(points, file); }, out);
+    return csv && json;
+}
@@ -0,0 +1,258 @@
+// Общая библиотека: параллельный префиксный скан (prefix sum) на CPU
+// В Practice7 (Доп_задание2) Blelloch scan реализован только на GPU, а эталон на CPU — последовательный цикл
+// h_scan_cpu[i] = h_scan_cpu[i-1] + h_array[i]. Здесь скан для узлов без GPU:
+//   - inclusiveScan / exclusiveScan для любой ассоциативной операции: без op — сумма, с op нейтральный элемент
+//     передаётся явно (T() годится только для суммы);
+//     exclusiveScan даёт тот же результат, что blellochScan (out[0] = 0, out[i] = a[0] + ... + a[i-1]);
+//   - трёхфазная схема reduce-then-scan: (1) каждый поток сворачивает свой кусок, (2) каждый поток сам
+//     складывает суммы кусков слева — смещение своего куска, (3) каждый поток сканирует кусок со смещением;
+//   - массив обрабатывается плитками по SCAN_TILE элементов на поток: второе чтение куска в фазе 3
+//     попадает в кэш L2, поэтому из памяти читается один раз и пишется один раз (скорость — пропускная способность памяти);
+//   - внутри куска для суммы int / long long / float используется SIMD-скан в регистре AVX2
+//     (сдвиги внутри регистра + перенос между половинами), выбор — по detectSimdLevel() из statistics.h;
+//   - запись на месте (in == out) разрешена.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <vector>        // Для перегрузок с vector
+#include <functional>    // Для plus
+#include <type_traits>   // Для is_same
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"   // Для threadRange и CACHE_LINE_SIZE
+#include "statistics.h"  // Для detectSimdLevel и HP_STATS_X86
+#include "arena.h"       // Для ScratchArray
+
+#if defined(HP_STATS_X86)
+#include <immintrin.h>   // Для интринсиков AVX2
+#endif
+
+const std::size_t SCAN_TILE = 1 << 14;                   // Элементов на поток в одной плитке (64 КБ для int — помещается в L2)
+const std::size_t SCAN_SEQUENTIAL_CUTOFF = 1 << 15;      // Ниже этого размера сканирует один поток
+
+// Частичная сумма куска одного потока, выровнена по кэш-линии
+template <typename T>
+struct alignas(CACHE_LINE_SIZE) ScanPartial {
+    T value;
+};
+
+// Операция — обычная сумма (для неё есть SIMD-путь и перестановка слагаемых при свёртке)
+template <typename T, typename Op>
+struct ScanIsPlus : std::integral_constant<bool,
+    std::is_arithmetic<T>::value && (std::is_same<Op, std::plus<T>>::value || std::is_same<Op, std::plus<>>::value)> {};
+
+// Свёртка куска in[0..n) начиная с init
+template <typename T, typename Op>
+T scanReduceChunk(const T* in, std::size_t n, T init, Op op) {
+    if constexpr (ScanIsPlus<T, Op>::value) {
+        T sum = T();                                              // Сумма коммутативна — SIMD-редукция
+        #pragma omp simd reduction(+:sum)
+        for (std::size_t i = 0; i < n; ++i) sum += in[i];
+        return init + sum;
+    } else {
+        T acc = init;                                             // Произвольная операция — строго слева направо
+        for (std::size_t i = 0; i < n; ++i) acc = op(acc, in[i]);
+        return acc;
+    }
+}
+
+// Последовательный скан куска со смещением offset (скалярный путь)
+template <typename T, typename Op>
+void scanChunkScalar(const T* in, T* out, std::size_t n, T offset, bool inclusive, Op op) {
+    T acc = offset;
+    if (inclusive) {
+        for (std::size_t i = 0; i < n; ++i) {
+            acc = op(acc, in[i]);
+            out[i] = acc;
+        }
+    } else {
+        for (std::size_t i = 0; i < n; ++i) {
+            T x = in[i];                                          // Читаем до записи — in может совпадать с out
+            out[i] = acc;
+            acc = op(acc, x);
+        }
+    }
+}
+
+#if defined(HP_STATS_X86)
+
+// SIMD-скан суммы 32-битных int: 8 элементов за шаг
+__attribute__((target("avx2")))
+inline std::size_t scanChunkAvx2(const int* in, int* out, std::size_t n, int& carry, bool inclusive) {
+    __m256i c = _mm256_set1_epi32(carry);                         // Сумма всех предыдущих элементов во всех линиях
+    const __m256i broadcast3 = _mm256_set1_epi32(3);
+    const __m256i broadcast7 = _mm256_set1_epi32(7);
+    const __m256i rotate = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+    const __m256i zero = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i s = _mm256_add_epi32(x, _mm256_slli_si256(x, 4)); // Префикс внутри 128-битных половин
+        s = _mm256_add_epi32(s, _mm256_slli_si256(s, 8));
+        __m256i low = _mm256_permutevar8x32_epi32(s, broadcast3); // Сумма нижней половины — в верхнюю
+        s = _mm256_add_epi32(s, _mm256_blend_epi32(zero, low, 0xF0));
+        s = _mm256_add_epi32(s, c);                               // Включающий префикс с переносом
+        __m256i r = inclusive ? s : _mm256_blend_epi32(_mm256_permutevar8x32_epi32(s, rotate), c, 0x01);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), r);
+        c = _mm256_permutevar8x32_epi32(s, broadcast7);           // Последний элемент — перенос на следующий шаг
+    }
+    carry = _mm256_cvtsi256_si32(c);
+    return i;
+}
+
+// SIMD-скан суммы 64-битных целых: 4 элемента за шаг
+__attribute__((target("avx2")))
+inline std::size_t scanChunkAvx2(const long long* in, long long* out, std::size_t n, long long& carry, bool inclusive) {
+    __m256i c = _mm256_set1_epi64x(carry);
+    const __m256i zero = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i s = _mm256_add_epi64(x, _mm256_slli_si256(x, 8)); // Префикс внутри половин
+        __m256i low = _mm256_permute4x64_epi64(s, 0x55);          // Элемент 1 во все линии
+        s = _mm256_add_epi64(s, _mm256_blend_epi32(zero, low, 0xF0));
+        s = _mm256_add_epi64(s, c);
+        __m256i r = inclusive ? s : _mm256_blend_epi32(_mm256_permute4x64_epi64(s, 0x93), c, 0x03); // Сдвиг на 1 элемент
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), r);
+        c = _mm256_permute4x64_epi64(s, 0xFF);                    // Элемент 3 во все линии
+    }
+    carry = _mm256_extract_epi64(c, 0);
+    return i;
+}
+
+// SIMD-скан суммы float: 8 элементов за шаг (порядок сложений отличается от последовательного — возможна разница в младших битах)
+__attribute__((target("avx2")))
+inline std::size_t scanChunkAvx2(const float* in, float* out, std::size_t n, float& carry, bool inclusive) {
+    __m256 c = _mm256_set1_ps(carry);
+    const __m256i broadcast3 = _mm256_set1_epi32(3);
+    const __m256i broadcast7 = _mm256_set1_epi32(7);
+    const __m256i rotate = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+    const __m256 zero = _mm256_setzero_ps();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 x = _mm256_loadu_ps(in + i);
+        __m256 s = _mm256_add_ps(x, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(x), 4)));
+        s = _mm256_add_ps(s, _mm256_castsi256_ps(_mm256_slli_si256(_mm256_castps_si256(s), 8)));
+        __m256 low = _mm256_permutevar8x32_ps(s, broadcast3);
+        s = _mm256_add_ps(s, _mm256_blend_ps(zero, low, 0xF0));
+        s = _mm256_add_ps(s, c);
+        __m256 r = inclusive ? s : _mm256_blend_ps(_mm256_permutevar8x32_ps(s, rotate), c, 0x01);
+        _mm256_storeu_ps(out + i, r);
+        c = _mm256_permutevar8x32_ps(s, broadcast7);
+    }
+    carry = _mm256_cvtss_f32(c);
+    return i;
+}
+
+#endif
+
+// Скан куска со смещением: SIMD для суммы 32/64-битных целых и float, иначе скалярно
+template <typename T, typename Op>
+void scanChunk(const T* in, T* out, std::size_t n, T offset, bool inclusive, Op op, SimdLevel level) {
+#if defined(HP_STATS_X86)
+    if constexpr (ScanIsPlus<T, Op>::value) {
+        if (level != SimdLevel::Scalar) {                         // AVX2 есть и на уровне AVX-512
+            // Целые одного размера складываются одинаково (по модулю 2^k) — int64_t, unsigned и т.п. идут тем же путём
+            using Lane = typename std::conditional<std::is_floating_point<T>::value, float,
+                         typename std::conditional<sizeof(T) == 8, long long, int>::type>::type;
+            if constexpr (sizeof(T) == sizeof(Lane) && std::is_floating_point<T>::value == std::is_floating_point<Lane>::value) {
+                Lane carry = static_cast<Lane>(offset);
+                std::size_t done = scanChunkAvx2(reinterpret_cast<const Lane*>(in), reinterpret_cast<Lane*>(out),
+                                                 n, carry, inclusive);
+                scanChunkScalar(in + done, out + done, n - done, static_cast<T>(carry), inclusive, op); // Хвост
+                return;
+            }
+        }
+    }
+#endif
+    (void)level;
+    scanChunkScalar(in, out, n, offset, inclusive, op);
+}
+
+// Общая реализация: трёхфазный скан плитками
+template <typename T, typename Op>
+void parallelScan(const T* in, T* out, std::size_t n, Op op, T identity, bool inclusive) {
+    if (n == 0) return;
+    SimdLevel level = detectSimdLevel();
+    if (n < SCAN_SEQUENTIAL_CUTOFF || omp_get_max_threads() == 1) {
+        scanChunk(in, out, n, identity, inclusive, op, level);   // Маленький массив — без потоков
+        return;
+    }
+
+    ScratchArray<ScanPartial<T>> partials(omp_get_max_threads());   // Из арены потока: без malloc на каждый вызов
+
+    #pragma omp parallel
+    {
+        int tid = omp_get_thread_num();
+        int nthreads = omp_get_num_threads();
+        std::size_t tileSize = SCAN_TILE * nthreads;              // Элементов в плитке
+        T carry = identity;                                       // Свёртка всех предыдущих плиток (одинакова у всех потоков)
+
+        for (std::size_t tileStart = 0; tileStart < n; tileStart += tileSize) {
+            std::size_t tileLength = n - tileStart < tileSize ? n - tileStart : tileSize;
+            std::size_t begin, end;
+            threadRange(tileLength, tid, nthreads, begin, end);   // Свой кусок плитки
+            begin += tileStart;
+            end += tileStart;
+
+            // Фаза 1: свёртка своего куска
+            partials[tid].value = scanReduceChunk(in + begin, end - begin, identity, op);
+            #pragma omp barrier
+
+            // Фаза 2: смещение куска — свёртка переноса и кусков слева (p слагаемых, каждый поток сам)
+            T offset = carry;
+            for (int t = 0; t < tid; ++t) offset = op(offset, partials[t].value);
+            for (int t = 0; t < nthreads; ++t) carry = op(carry, partials[t].value); // Перенос на следующую плитку
+
+            // Фаза 3: скан своего куска со смещением (кусок ещё в кэше после фазы 1)
+            scanChunk(in + begin, out + begin, end - begin, offset, inclusive, op, level);
+            #pragma omp barrier                                   // partials читаются всеми — не перезаписывать раньше
+        }
+    }
+}
+
+// Включающий скан: out[i] = in[0] op in[1] op ... op in[i]
+// identity — нейтральный элемент op (для max — numeric_limits<T>::lowest()); без op — сумма с нулём
+template <typename T, typename Op>
+void inclusiveScan(const T* in, T* out, std::size_t n, Op op, T identity) {
+    parallelScan(in, out, n, op, identity, true);
+}
+
+template <typename T>
+void inclusiveScan(const T* in, T* out, std::size_t n) {
+    inclusiveScan(in, out, n, std::plus<T>(), T());
+}
+
+// Исключающий скан: out[0] = identity, out[i] = in[0] op ... op in[i - 1] (как blellochScan)
+template <typename T, typename Op>
+void exclusiveScan(const T* in, T* out, std::size_t n, Op op, T identity) {
+    parallelScan(in, out, n, op, identity, false);
+}
+
+template <typename T>
+void exclusiveScan(const T* in, T* out, std::size_t n) {
+    exclusiveScan(in, out, n, std::plus<T>(), T());
+}
+
+// Перегрузки для vector (out получает размер in)
+template <typename T, typename Op>
+void inclusiveScan(const std::vector<T>& in, std::vector<T>& out, Op op, T identity) {
+    out.resize(in.size());
+    inclusiveScan(in.data(), out.data(), in.size(), op, identity);
+}
+
+template <typename T>
+void inclusiveScan(const std::vector<T>& in, std::vector<T>& out) {
+    inclusiveScan(in, out, std::plus<T>(), T());
+}
+
+template <typename T, typename Op>
+void exclusiveScan(const std::vector<T>& in, std::vector<T>& out, Op op, T identity) {
+    out.resize(in.size());
+    exclusiveScan(in.data(), out.data(), in.size(), op, identity);
+}
+
+template <typename T>
+void exclusiveScan(const std::vector<T>& in, std::vector<T>& out) {
+    exclusiveScan(in, out, std::plus<T>(), T());
+}
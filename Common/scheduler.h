@@ -0,0 +1,335 @@
+// Общая библиотека: гетерогенный планировщик с динамическим разбиением работы между исполнителями
+// В Assignment4_Task3 массив делится жёстко пополам (half = N / 2), и половина CPU считается до запуска
+// sumKernel — части не перекрываются, а более медленный исполнитель задерживает весь результат. Здесь:
+//   - исполнители — группы потоков CPU (с закреплением за ядрами или без), ускоритель через ComputeBackend
+//     и "заторможенная" группа CPU для проверки на машине без GPU;
+//   - у каждого исполнителя свой поток-драйвер, все исполнители работают одновременно;
+//   - доля диапазона и размер куска каждого исполнителя считаются по измеренной пропускной способности
+//     (элементов в ms, скользящая оценка по прошлым кускам): кусок занимает около SCHEDULER_CHUNK_MS;
+//   - куски лежат в очереди исполнителя; освободившийся исполнитель забирает работу с конца очереди того,
+//     кто по оценке закончит позже всех (work stealing), и только если сам успеет обработать украденное раньше,
+//     чем хозяин закончит свою очередь; большой кусок делится в отношении пропускных способностей вора и хозяина,
+//     чтобы оба закончили одновременно (без оценок — пополам);
+//   - первый запуск без оценок делит диапазон поровну на мелкие куски — кражи выравнивают нагрузку,
+//     а замеры кусков дают оценки для следующих запусков.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <string>        // Для имён исполнителей
+#include <vector>        // Для исполнителей и очередей
+#include <deque>         // Для очередей кусков
+#include <mutex>         // Для защиты очередей
+#include <thread>        // Для потоков-драйверов
+#include <chrono>        // Для замеров кусков и торможения
+#include <functional>    // Для function
+#include <memory>        // Для unique_ptr
+#include <utility>       // Для pair
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"       // Для threadRange
+#include "numa.h"            // Для setCurrentThreadCpus
+#include "compute_backend.h" // Для ускорителя
+
+const std::size_t SCHEDULER_MIN_CHUNK = 1 << 14;       // Наименьший кусок (меньше — накладные расходы заметнее работы)
+const double SCHEDULER_CHUNK_MS = 2.0;                 // Желаемое время одного куска
+const std::size_t SCHEDULER_PROBE_CHUNKS = 16;         // Кусков на исполнителя в запуске без оценок
+const double SCHEDULER_SMOOTHING = 0.5;                // Вес нового замера в скользящей оценке
+
+// Задача над диапазоном [0, n): обработка куска [begin, end) на CPU и (необязательно) на ускорителе
+struct HeteroTask {
+    std::function<void(std::size_t, std::size_t)> cpu;                       // Кусок в одном потоке CPU
+    std::function<void(ComputeBackend&, std::size_t, std::size_t)> device;   // Кусок на ускорителе (пусто — только CPU)
+};
+
+// Исполнитель кусков
+class Executor {
+public:
+    virtual ~Executor() {}
+    virtual std::string name() const = 0;
+    virtual bool supports(const HeteroTask&) const { return true; }
+    virtual void run(const HeteroTask& task, std::size_t begin, std::size_t end) = 0;
+};
+
+// Группа потоков CPU: кусок делится между threads потоками статически; cores — ядра для закрепления
+// (пусто — без закрепления); slowdown > 1 — после куска исполнитель ждёт (slowdown - 1) его времени,
+// то есть работает в slowdown раз медленнее (имитация более медленного устройства)
+class CpuExecutor : public Executor {
+public:
+    CpuExecutor(const std::string& name, int threads, const std::vector<int>& cores = std::vector<int>(), double slowdown = 1.0)
+        : name_(name), threads_(threads < 1 ? 1 : threads), cores_(cores), slowdown_(slowdown) {}
+
+    std::string name() const override { return name_; }
+
+    void run(const HeteroTask& task, std::size_t begin, std::size_t end) override {
+        auto start = std::chrono::steady_clock::now();
+        #pragma omp parallel num_threads(threads_) if (threads_ > 1)
+        {
+            int tid = omp_get_thread_num();
+            std::size_t b, e;
+            threadRange(end - begin, tid, omp_get_num_threads(), b, e);
+            if (!cores_.empty()) {                              // Закрепление (numa.h); то же ядро — без системного вызова
+                thread_local int pinned = -1;
+                int core = cores_[tid % cores_.size()];
+                if (pinned != core && setCurrentThreadCpus(std::vector<int>(1, core))) pinned = core;
+            }
+            if (b < e) task.cpu(begin + b, begin + e);
+        }
+        if (slowdown_ > 1.0) {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            std::this_thread::sleep_for(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed * (slowdown_ - 1.0)));
+        }
+    }
+
+private:
+    std::string name_;
+    int threads_;
+    std::vector<int> cores_;
+    double slowdown_;
+};
+
+// Ускоритель: кусок выполняется через ComputeBackend (например, CUDA из cuda_backend.cu)
+class BackendExecutor : public Executor {
+public:
+    explicit BackendExecutor(std::unique_ptr<ComputeBackend> backend) : backend_(std::move(backend)) {}
+
+    std::string name() const override { return backend_->name(); }
+    bool supports(const HeteroTask& task) const override { return static_cast<bool>(task.device); }
+    void run(const HeteroTask& task, std::size_t begin, std::size_t end) override { task.device(*backend_, begin, end); }
+
+private:
+    std::unique_ptr<ComputeBackend> backend_;
+};
+
+// Статистика исполнителя за один запуск
+struct ExecutorStats {
+    std::string name;
+    std::size_t elements = 0;          // Обработано элементов
+    std::size_t chunks = 0;            // Выполнено кусков
+    std::size_t stolen = 0;            // Из них украдено у других исполнителей
+    double busyMs = 0;                 // Время работы
+    double throughput = 0;             // Оценка пропускной способности после запуска, элементов/ms
+};
+
+// Отчёт запуска
+struct ScheduleReport {
+    double totalMs = 0;                // Время от начала до завершения последнего куска
+    std::vector<ExecutorStats> executors;
+};
+
+class HeteroScheduler {
+public:
+    typedef std::pair<std::size_t, std::size_t> Range;
+
+    void addExecutor(std::unique_ptr<Executor> executor) {
+        executors_.push_back(std::move(executor));
+        throughput_.push_back(0);
+    }
+
+    std::size_t executorCount() const { return executors_.size(); }
+
+    const std::vector<double>& throughput() const { return throughput_; }
+
+    // Динамическое разбиение: доли и куски по оценкам пропускной способности, кражи между очередями
+    ScheduleReport run(const HeteroTask& task, std::size_t n) {
+        std::vector<std::size_t> active = activeExecutors(task);
+        std::vector<std::vector<Range>> plan(executors_.size());
+        if (active.empty() || n == 0) return execute(task, plan, false);
+
+        bool measured = true;
+        double total = 0;
+        for (std::size_t e : active) {
+            measured = measured && throughput_[e] > 0;
+            total += throughput_[e];
+        }
+
+        std::size_t offset = 0;
+        for (std::size_t k = 0; k < active.size(); ++k) {
+            std::size_t e = active[k];
+            double share = measured ? throughput_[e] / total : 1.0 / active.size();
+            std::size_t size = k + 1 == active.size() ? n - offset : static_cast<std::size_t>(share * n);
+            if (size > n - offset) size = n - offset;
+            std::size_t chunk = measured ? static_cast<std::size_t>(throughput_[e] * SCHEDULER_CHUNK_MS)
+                                         : n / (active.size() * SCHEDULER_PROBE_CHUNKS);
+            if (chunk < SCHEDULER_MIN_CHUNK) chunk = SCHEDULER_MIN_CHUNK;
+            for (std::size_t b = offset; b < offset + size; b += chunk) {
+                plan[e].push_back(Range(b, offset + size - b < chunk ? offset + size : b + chunk));
+            }
+            offset += size;
+        }
+        return execute(task, plan, true);
+    }
+
+    // Статическое разбиение (как half = N / 2): исполнитель e получает один кусок долей shares[e], без краж
+    ScheduleReport runStatic(const HeteroTask& task, std::size_t n, const std::vector<double>& shares) {
+        std::vector<std::vector<Range>> plan(executors_.size());
+        double total = 0;
+        for (std::size_t e = 0; e < executors_.size() && e < shares.size(); ++e) {
+            if (executors_[e]->supports(task)) total += shares[e];
+        }
+        std::size_t offset = 0;
+        std::size_t last = executors_.size();
+        for (std::size_t e = 0; e < executors_.size() && e < shares.size(); ++e) {
+            if (!executors_[e]->supports(task) || shares[e] <= 0) continue;
+            std::size_t size = static_cast<std::size_t>(shares[e] / total * n);
+            if (size > n - offset) size = n - offset;
+            if (size) plan[e].push_back(Range(offset, offset + size));
+            offset += size;
+            last = e;
+        }
+        if (offset < n && last < executors_.size()) {                  // Остаток от округления — последнему
+            if (!plan[last].empty() && plan[last].back().second == offset) plan[last].back().second = n;
+            else plan[last].push_back(Range(offset, n));
+        }
+        return execute(task, plan, false);
+    }
+
+private:
+    struct ChunkQueue {
+        std::mutex mutex;
+        std::deque<Range> chunks;
+        std::size_t remaining = 0;     // Элементов в очереди
+        double rate = 0;               // Пропускная способность хозяина, элементов/ms (0 — ещё не измерена)
+    };
+
+    std::vector<std::size_t> activeExecutors(const HeteroTask& task) const {
+        std::vector<std::size_t> active;
+        for (std::size_t e = 0; e < executors_.size(); ++e) {
+            if (executors_[e]->supports(task)) active.push_back(e);
+        }
+        return active;
+    }
+
+    // Свой кусок — с начала очереди
+    static bool popFront(ChunkQueue& q, Range& r) {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.chunks.empty()) return false;
+        r = q.chunks.front();
+        q.chunks.pop_front();
+        q.remaining -= r.second - r.first;
+        return true;
+    }
+
+    // Кража с конца очереди исполнителя, который по оценке закончит позже всех. selfRate — пропускная способность вора.
+    // При известных оценках вор берёт selfRate / (selfRate + rate) оставшейся работы хозяина (оба заканчивают вместе)
+    // и крадёт, только если обработает украденное раньше, чем хозяин закончит всю очередь; иначе — пополам
+    static bool steal(std::vector<std::unique_ptr<ChunkQueue>>& queues, std::size_t self, double selfRate, Range& r) {
+        while (true) {
+            std::vector<std::size_t> remaining(queues.size(), 0);
+            std::vector<double> rates(queues.size(), 0);
+            bool known = selfRate > 0;                                 // Оценки есть у вора и у всех с работой
+            for (std::size_t v = 0; v < queues.size(); ++v) {
+                if (v == self) continue;
+                std::lock_guard<std::mutex> lock(queues[v]->mutex);
+                remaining[v] = queues[v]->remaining;
+                rates[v] = queues[v]->rate;
+                if (remaining[v] > 0 && rates[v] <= 0) known = false;
+            }
+            std::size_t victim = queues.size();
+            double latest = 0;                                         // Время до конца очереди (или её размер)
+            for (std::size_t v = 0; v < queues.size(); ++v) {
+                if (remaining[v] == 0) continue;
+                double finish = known ? remaining[v] / rates[v] : static_cast<double>(remaining[v]);
+                if (finish > latest) {
+                    latest = finish;
+                    victim = v;
+                }
+            }
+            if (victim == queues.size()) return false;                 // Работы не осталось нигде
+
+            ChunkQueue& q = *queues[victim];
+            std::lock_guard<std::mutex> lock(q.mutex);
+            if (q.chunks.empty()) continue;                            // Хозяин успел забрать — ищем снова
+            known = selfRate > 0 && q.rate > 0;
+            Range back = q.chunks.back();
+            std::size_t length = back.second - back.first;
+            std::size_t want = known ? static_cast<std::size_t>(q.remaining * (selfRate / (selfRate + q.rate)))
+                                     : length / 2;
+            if (want < SCHEDULER_MIN_CHUNK) want = SCHEDULER_MIN_CHUNK;
+            std::size_t take = length >= want + SCHEDULER_MIN_CHUNK ? want : length; // Остаток хозяину — не меньше куска
+            if (known && take / selfRate >= q.remaining / q.rate) return false; // Хозяин закончит раньше вора
+
+            q.chunks.pop_back();
+            q.remaining -= take;
+            r = Range(back.second - take, back.second);                // Вор берёт правую часть
+            if (take < length) q.chunks.push_back(Range(back.first, back.second - take));
+            return true;
+        }
+    }
+
+    ScheduleReport execute(const HeteroTask& task, const std::vector<std::vector<Range>>& plan, bool stealing) {
+        std::size_t count = executors_.size();
+        std::vector<std::unique_ptr<ChunkQueue>> queues;
+        for (std::size_t e = 0; e < count; ++e) {
+            queues.push_back(std::unique_ptr<ChunkQueue>(new ChunkQueue()));
+            queues[e]->rate = throughput_[e];
+            for (const Range& r : plan[e]) {
+                queues[e]->chunks.push_back(r);
+                queues[e]->remaining += r.second - r.first;
+            }
+        }
+
+        ScheduleReport report;
+        report.executors.resize(count);
+        std::vector<bool> active(count);
+        for (std::size_t e = 0; e < count; ++e) {
+            report.executors[e].name = executors_[e]->name();
+            active[e] = executors_[e]->supports(task) && (stealing || !plan[e].empty());
+        }
+
+        auto driver = [&](std::size_t e) {                             // Поток-драйвер исполнителя e
+            ExecutorStats& stats = report.executors[e];
+            Range r;
+            while (true) {
+                bool stolen = false;
+                if (!popFront(*queues[e], r)) {
+                    if (!stealing || !steal(queues, e, throughput_[e], r)) break;
+                    stolen = true;
+                }
+                auto start = std::chrono::steady_clock::now();
+                executors_[e]->run(task, r.first, r.second);
+                double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+                std::size_t elements = r.second - r.first;
+                stats.elements += elements;
+                stats.chunks++;
+                stats.stolen += stolen;
+                stats.busyMs += ms;
+                if (ms > 0) {                                          // Скользящая оценка элементов/ms
+                    double rate = elements / ms;
+                    throughput_[e] = throughput_[e] > 0 ? (1 - SCHEDULER_SMOOTHING) * throughput_[e] + SCHEDULER_SMOOTHING * rate
+                                                        : rate;
+                    std::lock_guard<std::mutex> lock(queues[e]->mutex);   // Оценку хозяина читают воры
+                    queues[e]->rate = throughput_[e];
+                }
+            }
+            stats.throughput = throughput_[e];
+        };
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        std::size_t first = count;                                     // Первый активный — в текущем потоке
+        for (std::size_t e = 0; e < count; ++e) {
+            if (!active[e]) continue;
+            if (first == count) first = e;
+            else threads.push_back(std::thread(driver, e));
+        }
+        if (first < count) driver(first);
+        for (std::thread& t : threads) t.join();
+        report.totalMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return report;
+    }
+
+    std::vector<std::unique_ptr<Executor>> executors_;
+    std::vector<double> throughput_;   // Оценки пропускной способности, элементов/ms (0 — ещё не измерено)
+};
+
+// Группы потоков CPU, закреплённые за соседними ядрами: groups групп по threadsPerGroup потоков
+inline void addPinnedCpuGroups(HeteroScheduler& scheduler, int groups, int threadsPerGroup) {
+    int cores = omp_get_num_procs();
+    for (int g = 0; g < groups; ++g) {
+        std::vector<int> pinned;
+        for (int t = 0; t < threadsPerGroup; ++t) pinned.push_back((g * threadsPerGroup + t) % cores);
+        scheduler.addExecutor(std::unique_ptr<Executor>(
+            new CpuExecutor("cpu-group" + std::to_string(g), threadsPerGroup, pinned)));
+    }
+}
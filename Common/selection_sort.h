@@ -0,0 +1,119 @@
+// Общая библиотека: параллельная сортировка выбором с постоянной командой потоков
+// Старая версия selectionSortParallel открывала #pragma omp parallel на каждой итерации внешнего цикла
+// (n созданий команды) и сливала минимумы через omp critical. Здесь:
+//   - одна параллельная область на всю сортировку, потоки живут все n итераций;
+//   - массив поделён на куски по SELECTION_CHUNK элементов, куски закреплены за потоками по кругу
+//     (кусок c принадлежит потоку c % p), поэтому нагрузка равномерна до самого конца;
+//   - каждый поток ищет argmin в своих кусках (векторизованный argMinRange) и пишет его в свою ячейку,
+//     выровненную по кэш-линии; после одного барьера каждый поток сам сворачивает ячейки — critical нет;
+//   - обмен a[i] и a[min] выполняют владельцы этих позиций, поэтому второй барьер не нужен;
+//     ячейки двойные (по чётности итерации), чтобы быстрый поток не перезаписал ещё читаемые данные;
+//   - когда неотсортированная часть меньше SELECTION_PARALLEL_CUTOFF, барьер дороже поиска —
+//     команда завершается и остаток сортируется последовательно.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <vector>        // Для ячеек потоков
+#include <utility>       // Для swap
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"   // Для argMinRange и CACHE_LINE_SIZE
+
+const std::size_t SELECTION_CHUNK = 2048;              // Размер куска, закреплённого за потоком
+const std::size_t SELECTION_PARALLEL_CUTOFF = 4096;    // Остаток меньше этого сортируется последовательно
+                                                       // (барьер стоит столько же, сколько поиск в ~4000 элементах)
+
+// Ячейка потока: результат поиска и значение a[i], если поток владеет позицией i
+template <typename T>
+struct alignas(CACHE_LINE_SIZE) SelectionSlot {
+    T value = T();                                     // Локальный минимум
+    std::size_t index = 0;                             // Индекс локального минимума
+    T head = T();                                      // Текущее значение a[i] (у владельца позиции i)
+    bool found = false;                                // Поток нашёл хотя бы один элемент
+    bool ownsHead = false;                             // Поток владеет позицией i
+};
+
+// Последовательная сортировка выбором позиций [from, n) (поиск минимума векторизован)
+template <typename T>
+void selectionSortRange(T* a, std::size_t from, std::size_t n) {
+    for (std::size_t i = from; i + 1 < n; ++i) {
+        T minValue;
+        std::size_t minIndex;
+        argMinRange(a, i, n, minValue, minIndex);      // Первый минимум в [i, n)
+        std::swap(a[i], a[minIndex]);
+    }
+}
+
+// Параллельная сортировка выбором с постоянной командой потоков
+template <typename T>
+void selectionSortTeam(T* a, std::size_t n) {
+    int maxThreads = omp_get_max_threads();
+    if (maxThreads == 1 || n <= SELECTION_PARALLEL_CUTOFF) {
+        selectionSortRange(a, 0, n);                   // Маленький массив — без потоков
+        return;
+    }
+
+    std::size_t parallelEnd = n - SELECTION_PARALLEL_CUTOFF;                      // Итерации [0, parallelEnd) — командой
+    std::vector<SelectionSlot<T>> slots(2 * static_cast<std::size_t>(maxThreads)); // Двойной набор ячеек
+
+    #pragma omp parallel
+    {
+        std::size_t tid = omp_get_thread_num();
+        std::size_t nthreads = omp_get_num_threads();
+        auto owner = [nthreads](std::size_t pos) { return (pos / SELECTION_CHUNK) % nthreads; }; // Владелец позиции
+
+        for (std::size_t i = 0; i < parallelEnd; ++i) {
+            SelectionSlot<T>* row = &slots[(i & 1) * maxThreads];  // Ячейки этой итерации
+            SelectionSlot<T>& my = row[tid];
+            my.found = false;
+            my.ownsHead = false;
+
+            // Поиск минимума в своих кусках, пересекающих [i, n)
+            std::size_t firstChunk = i / SELECTION_CHUNK;
+            std::size_t c = firstChunk + (tid + nthreads - firstChunk % nthreads) % nthreads; // Первый свой кусок
+            for (; c * SELECTION_CHUNK < n; c += nthreads) {
+                std::size_t begin = c * SELECTION_CHUNK > i ? c * SELECTION_CHUNK : i;
+                std::size_t end = (c + 1) * SELECTION_CHUNK < n ? (c + 1) * SELECTION_CHUNK : n;
+                T v;
+                std::size_t idx;
+                argMinRange(a, begin, end, v, idx);
+                if (!my.found || v < my.value) {       // Куски идут по возрастанию индексов — при равенстве остаётся первый
+                    my.value = v;
+                    my.index = idx;
+                    my.found = true;
+                }
+            }
+            if (owner(i) == tid) {                     // Владелец позиции i публикует её значение
+                my.head = a[i];
+                my.ownsHead = true;
+            }
+            #pragma omp barrier
+
+            // Каждый поток сам сворачивает ячейки (только чтение — critical не нужен)
+            T minValue = T();
+            T headValue = T();
+            std::size_t minIndex = n;
+            for (std::size_t t = 0; t < nthreads; ++t) {
+                const SelectionSlot<T>& s = row[t];
+                if (s.found && (minIndex == n || s.value < minValue || (s.value == minValue && s.index < minIndex))) {
+                    minValue = s.value;
+                    minIndex = s.index;
+                }
+                if (s.ownsHead) headValue = s.head;
+            }
+
+            // Обмен выполняют владельцы позиций: позицию p читает и пишет только owner(p)
+            if (minIndex != i) {
+                if (owner(minIndex) == tid) a[minIndex] = headValue;
+                if (owner(i) == tid) a[i] = minValue;
+            }
+        }
+    }                                                  // Неявный барьер: все записи видны
+
+    selectionSortRange(a, parallelEnd, n);             // Остаток — последовательно
+}
+
+template <typename T>
+void selectionSortTeam(std::vector<T>& arr) {
+    selectionSortTeam(arr.data(), arr.size());
+}
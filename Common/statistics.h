@@ -0,0 +1,300 @@
+// Общая библиотека: статистика массива за один проход по памяти
+// min, max, сумма, среднее и дисперсия (Уэлфорд / Чан) считаются одним чтением массива:
+//   - массив обрабатывается блоками по STATS_BLOCK_SIZE элементов (блок помещается в L1-кэш);
+//   - первый обход блока: min / max / сумма (SIMD), второй обход того же блока из кэша: сумма квадратов отклонений;
+//   - статистики блоков объединяются формулой Чана (параллельный вариант алгоритма Уэлфорда), поэтому
+//     дисперсия считается устойчиво, без вычитания больших чисел E[x²] - E[x]²;
+//   - для int ядро выбирается во время выполнения: AVX-512, AVX2 или скалярное;
+//   - потоки OpenMP обрабатывают непрерывные куски, частичные результаты выровнены по кэш-линии.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <climits>       // Для INT_MAX / INT_MIN
+#include <cmath>         // Для sqrt
+#include <vector>        // Для частичных результатов потоков
+#include <omp.h>         // Для OpenMP
+#include "reduction.h"   // Для SumType, CACHE_LINE_SIZE, threadRange, REDUCTION_SEQUENTIAL_CUTOFF
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HP_STATS_X86 1   // Доступны AVX2 / AVX-512 ядра через target-атрибуты GCC/Clang
+#include <immintrin.h>   // Для интринсиков AVX2 / AVX-512
+#endif
+
+const std::size_t STATS_BLOCK_SIZE = 2048;     // Размер блока: 8 КБ для int, помещается в L1
+
+// Уровень SIMD, которым считается ядро
+enum class SimdLevel { Scalar, Avx2, Avx512 };
+
+// Название уровня SIMD для вывода
+inline const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Avx512: return "AVX-512";
+        case SimdLevel::Avx2:   return "AVX2";
+        default:                return "scalar";
+    }
+}
+
+// Определение лучшего доступного уровня SIMD на текущем процессоре (один раз за запуск)
+inline SimdLevel detectSimdLevel() {
+#ifdef HP_STATS_X86
+    static const SimdLevel level = [] {
+        __builtin_cpu_init();                                         // Инициализация cpuid-информации
+        if (__builtin_cpu_supports("avx512f")) return SimdLevel::Avx512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SimdLevel::Avx2;
+        return SimdLevel::Scalar;
+    }();
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+// Статистика массива
+template <typename T>
+struct Statistics {
+    T minValue = std::numeric_limits<T>::max();      // Минимум
+    T maxValue = std::numeric_limits<T>::lowest();   // Максимум
+    SumType<T> sum = 0;                              // Сумма (64-битная для целых)
+    std::size_t count = 0;                           // Количество элементов
+    double mean = 0.0;                               // Среднее значение
+    double m2 = 0.0;                                 // Сумма квадратов отклонений от среднего
+
+    double variance() const {                        // Дисперсия генеральной совокупности
+        return count == 0 ? 0.0 : m2 / count;
+    }
+    double sampleVariance() const {                  // Выборочная (несмещённая) дисперсия
+        return count < 2 ? 0.0 : m2 / (count - 1);
+    }
+    double stddev() const {                          // Стандартное отклонение
+        return std::sqrt(variance());
+    }
+};
+
+// Объединение двух статистик формулой Чана
+template <typename T>
+void mergeStatistics(Statistics<T>& into, const Statistics<T>& from) {
+    if (from.count == 0) return;                     // Пустая часть ничего не меняет
+    if (into.count == 0) { into = from; return; }    // Первая непустая часть
+
+    double na = static_cast<double>(into.count);
+    double nb = static_cast<double>(from.count);
+    double n = na + nb;
+    double delta = from.mean - into.mean;            // Разница средних частей
+
+    into.mean += delta * nb / n;                     // Новое среднее
+    into.m2 += from.m2 + delta * delta * na * nb / n;// Новая сумма квадратов отклонений
+    if (from.minValue < into.minValue) into.minValue = from.minValue;
+    if (from.maxValue > into.maxValue) into.maxValue = from.maxValue;
+    into.sum += from.sum;
+    into.count += from.count;
+}
+
+// Скалярное ядро одного блока (любой арифметический тип)
+template <typename T>
+Statistics<T> blockStatisticsScalar(const T* data, std::size_t n) {
+    Statistics<T> s;
+    if (n == 0) return s;
+
+    ReductionResult<T> r = reduceRange(data, 0, n);  // Первый обход: min / max / сумма
+    s.minValue = r.minValue;
+    s.maxValue = r.maxValue;
+    s.sum = r.sum;
+    s.count = n;
+    s.mean = static_cast<double>(r.sum) / n;
+
+    double m2 = 0.0;                                 // Второй обход блока (данные уже в L1)
+    #pragma omp simd reduction(+:m2)
+    for (std::size_t i = 0; i < n; ++i) {
+        double d = static_cast<double>(data[i]) - s.mean;
+        m2 += d * d;
+    }
+    s.m2 = m2;
+    return s;
+}
+
+#ifdef HP_STATS_X86
+
+// AVX2 ядро одного блока int (8 элементов за инструкцию)
+__attribute__((target("avx2,fma")))
+inline Statistics<int> blockStatisticsAvx2(const int* data, std::size_t n) {
+    Statistics<int> s;
+    if (n == 0) return s;
+
+    __m256i vmin = _mm256_set1_epi32(INT_MAX);       // 8 минимумов
+    __m256i vmax = _mm256_set1_epi32(INT_MIN);       // 8 максимумов
+    __m256i vsum = _mm256_setzero_si256();           // 4 суммы по 64 бита
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        vmin = _mm256_min_epi32(vmin, x);
+        vmax = _mm256_max_epi32(vmax, x);
+        __m256i lo = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x));      // Младшие 4 элемента → int64
+        __m256i hi = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1)); // Старшие 4 элемента → int64
+        vsum = _mm256_add_epi64(vsum, _mm256_add_epi64(lo, hi));
+    }
+
+    alignas(32) int mins[8], maxs[8];                // Горизонтальная свёртка регистров
+    alignas(32) long long sums[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(mins), vmin);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(maxs), vmax);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(sums), vsum);
+    int mn = INT_MAX, mx = INT_MIN;
+    long long sum = sums[0] + sums[1] + sums[2] + sums[3];
+    for (int l = 0; l < 8; ++l) {
+        mn = mins[l] < mn ? mins[l] : mn;
+        mx = maxs[l] > mx ? maxs[l] : mx;
+    }
+    for (; i < n; ++i) {                             // Хвост блока
+        mn = data[i] < mn ? data[i] : mn;
+        mx = data[i] > mx ? data[i] : mx;
+        sum += data[i];
+    }
+
+    s.minValue = mn;
+    s.maxValue = mx;
+    s.sum = sum;
+    s.count = n;
+    s.mean = static_cast<double>(sum) / n;
+
+    __m256d vmean = _mm256_set1_pd(s.mean);          // Второй обход: Σ(x - mean)² в double
+    __m256d acc0 = _mm256_setzero_pd();
+    __m256d acc1 = _mm256_setzero_pd();
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256d d0 = _mm256_sub_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(x)), vmean);
+        __m256d d1 = _mm256_sub_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(x, 1)), vmean);
+        acc0 = _mm256_fmadd_pd(d0, d0, acc0);
+        acc1 = _mm256_fmadd_pd(d1, d1, acc1);
+    }
+    alignas(32) double parts[4];
+    _mm256_store_pd(parts, _mm256_add_pd(acc0, acc1));
+    double m2 = parts[0] + parts[1] + parts[2] + parts[3];
+    for (; i < n; ++i) {
+        double d = data[i] - s.mean;
+        m2 += d * d;
+    }
+    s.m2 = m2;
+    return s;
+}
+
+// GCC 12 выдаёт ложные -Wmaybe-uninitialized внутри собственных AVX-512 интринсиков (_mm512_undefined_*)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// AVX-512 ядро одного блока int (16 элементов за инструкцию)
+__attribute__((target("avx512f")))
+inline Statistics<int> blockStatisticsAvx512(const int* data, std::size_t n) {
+    Statistics<int> s;
+    if (n == 0) return s;
+
+    __m512i vmin = _mm512_set1_epi32(INT_MAX);
+    __m512i vmax = _mm512_set1_epi32(INT_MIN);
+    __m512i vsum = _mm512_setzero_si512();           // 8 сумм по 64 бита
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m512i x = _mm512_loadu_si512(data + i);
+        vmin = _mm512_min_epi32(vmin, x);
+        vmax = _mm512_max_epi32(vmax, x);
+        __m512i lo = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(x));
+        __m512i hi = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(x, 1));
+        vsum = _mm512_add_epi64(vsum, _mm512_add_epi64(lo, hi));
+    }
+    int mn = _mm512_reduce_min_epi32(vmin);          // Горизонтальная свёртка
+    int mx = _mm512_reduce_max_epi32(vmax);
+    long long sum = _mm512_reduce_add_epi64(vsum);
+    for (; i < n; ++i) {
+        mn = data[i] < mn ? data[i] : mn;
+        mx = data[i] > mx ? data[i] : mx;
+        sum += data[i];
+    }
+
+    s.minValue = mn;
+    s.maxValue = mx;
+    s.sum = sum;
+    s.count = n;
+    s.mean = static_cast<double>(sum) / n;
+
+    __m512d vmean = _mm512_set1_pd(s.mean);
+    __m512d acc0 = _mm512_setzero_pd();
+    __m512d acc1 = _mm512_setzero_pd();
+    for (i = 0; i + 16 <= n; i += 16) {
+        __m512i x = _mm512_loadu_si512(data + i);
+        __m512d d0 = _mm512_sub_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(x)), vmean);
+        __m512d d1 = _mm512_sub_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(x, 1)), vmean);
+        acc0 = _mm512_fmadd_pd(d0, d0, acc0);
+        acc1 = _mm512_fmadd_pd(d1, d1, acc1);
+    }
+    double m2 = _mm512_reduce_add_pd(_mm512_add_pd(acc0, acc1));
+    for (; i < n; ++i) {
+        double d = data[i] - s.mean;
+        m2 += d * d;
+    }
+    s.m2 = m2;
+    return s;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // HP_STATS_X86
+
+// Статистика одного блока: общий шаблон всегда скалярный
+template <typename T>
+Statistics<T> blockStatistics(const T* data, std::size_t n, SimdLevel) {
+    return blockStatisticsScalar(data, n);
+}
+
+// Статистика одного блока int: выбор ядра по уровню SIMD
+inline Statistics<int> blockStatistics(const int* data, std::size_t n, SimdLevel level) {
+#ifdef HP_STATS_X86
+    if (level == SimdLevel::Avx512) return blockStatisticsAvx512(data, n);
+    if (level == SimdLevel::Avx2) return blockStatisticsAvx2(data, n);
+#endif
+    (void)level;
+    return blockStatisticsScalar(data, n);
+}
+
+// Частичная статистика одного потока, выровнена по кэш-линии
+template <typename T>
+struct alignas(CACHE_LINE_SIZE) StatisticsPartial {
+    Statistics<T> value;
+};
+
+// Параллельная статистика массива за один проход (level — уровень SIMD, по умолчанию лучший доступный)
+template <typename T>
+Statistics<T> parallelStatistics(const T* data, std::size_t n, SimdLevel level = detectSimdLevel()) {
+    std::vector<StatisticsPartial<T>> partials(omp_get_max_threads());
+    int usedThreads = 1;
+
+    #pragma omp parallel if (n >= REDUCTION_SEQUENTIAL_CUTOFF)
+    {
+        int tid = omp_get_thread_num();
+        int nthreads = omp_get_num_threads();
+        std::size_t begin, end;
+        threadRange(n, tid, nthreads, begin, end);   // Свой непрерывный кусок
+
+        Statistics<T> local;                         // Статистика потока
+        for (std::size_t b = begin; b < end; b += STATS_BLOCK_SIZE) {
+            std::size_t len = end - b < STATS_BLOCK_SIZE ? end - b : STATS_BLOCK_SIZE;
+            mergeStatistics(local, blockStatistics(data + b, len, level));
+        }
+        partials[tid].value = local;
+        if (tid == 0) usedThreads = nthreads;
+    }
+
+    Statistics<T> result;                            // Слияние потоков по порядку
+    for (int t = 0; t < usedThreads; ++t) {
+        mergeStatistics(result, partials[t].value);
+    }
+    return result;
+}
+
+// Перегрузка для vector
+template <typename T>
+Statistics<T> parallelStatistics(const std::vector<T>& v, SimdLevel level = detectSimdLevel()) {
+    return parallelStatistics(v.data(), v.size(), level);
+}
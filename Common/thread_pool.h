@@ -0,0 +1,342 @@
+// Общая библиотека: постоянный пул потоков с перехватом работы (work stealing)
+// Каждая параллельная функция Common открывает свою область #pragma omp parallel на каждый вызов,
+// а рекурсивные алгоритмы (mergeSort / quickSort из Practice3task4) на OpenMP требуют вложенных областей
+// или omp task внутри single. Здесь:
+//   - потоки создаются один раз и живут до конца программы (ThreadPool::global());
+//   - у каждого рабочего потока своя дека Чейза–Лева: владелец кладёт и берёт задачи с одного конца
+//     без блокировок, свободные потоки крадут с другого конца (старые, то есть самые крупные задачи);
+//   - задачи из потоков вне пула попадают в общую очередь с mutex;
+//   - поток без работы немного крутится, затем засыпает на condition_variable (parking) и просыпается,
+//     когда появляется новая задача;
+//   - TaskGroup::spawn / sync — порождение и ожидание задач; ожидающий поток не спит, а выполняет задачи
+//     (свои или украденные), поэтому рекурсия любой глубины не блокирует пул;
+//   - parallelFor / parallelReduce делят диапазон рекурсивно пополам до grain элементов.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <cstdint>       // Для int64_t
+#include <atomic>        // Для atomic
+#include <vector>        // Для рабочих потоков и дек
+#include <deque>         // Для общей очереди
+#include <memory>        // Для unique_ptr
+#include <mutex>         // Для общей очереди и парковки
+#include <condition_variable> // Для парковки
+#include <thread>        // Для рабочих потоков
+#include <functional>    // Для function
+#include <utility>       // Для move
+#include <omp.h>         // Для omp_get_max_threads (размер пула по умолчанию)
+
+const std::size_t POOL_DEQUE_CAPACITY = 256;           // Начальная ёмкость деки (растёт при переполнении)
+const int POOL_SPIN_ROUNDS = 64;                       // Попыток найти работу перед парковкой
+
+// Дека Чейза–Лева (вариант Лё, Поп, Коэн, Нарделли, 2013): push / pop — только владелец, steal — любой поток
+// Массив растёт вдвое при переполнении; старые массивы хранятся до разрушения деки (их могут читать воры)
+template <typename T>
+class WorkStealingDeque {
+public:
+    WorkStealingDeque() {
+        arrays_.push_back(std::unique_ptr<Array>(new Array(POOL_DEQUE_CAPACITY)));
+        array_.store(arrays_.back().get(), std::memory_order_relaxed);
+        top_.store(0, std::memory_order_relaxed);
+        bottom_.store(0, std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Владелец: в нижний конец
+    void push(T item) {
+        std::int64_t b = bottom_.load(std::memory_order_relaxed);
+        std::int64_t t = top_.load(std::memory_order_acquire);
+        Array* a = array_.load(std::memory_order_relaxed);
+        if (b - t > static_cast<std::int64_t>(a->capacity) - 1) a = grow(a, t, b);
+        a->put(b, item);
+        bottom_.store(b + 1, std::memory_order_release);               // Публикация задачи ворам (acquire в steal)
+    }
+
+    // Владелец: из нижнего конца (последняя положенная задача); false — пусто
+    bool pop(T& item) {
+        std::int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Array* a = array_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top_.load(std::memory_order_relaxed);
+        if (t > b) {                                                   // Пусто
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        item = a->get(b);
+        if (t == b) {                                                  // Последний элемент — гонка с ворами
+            bool won = top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // Любой поток: из верхнего конца (самая старая задача); false — пусто или проиграл гонку
+    bool steal(T& item) {
+        std::int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) return false;
+        Array* a = array_.load(std::memory_order_acquire);
+        item = a->get(t);
+        return top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+private:
+    struct Array {
+        std::size_t capacity;
+        std::unique_ptr<std::atomic<T>[]> items;
+
+        explicit Array(std::size_t c) : capacity(c), items(new std::atomic<T>[c]) {}
+        T get(std::int64_t i) const { return items[i & (capacity - 1)].load(std::memory_order_relaxed); }
+        void put(std::int64_t i, T x) { items[i & (capacity - 1)].store(x, std::memory_order_relaxed); }
+    };
+
+    Array* grow(Array* old, std::int64_t t, std::int64_t b) {
+        arrays_.push_back(std::unique_ptr<Array>(new Array(old->capacity * 2)));
+        Array* a = arrays_.back().get();
+        for (std::int64_t i = t; i < b; ++i) a->put(i, old->get(i));
+        array_.store(a, std::memory_order_release);
+        return a;
+    }
+
+    alignas(64) std::atomic<std::int64_t> top_;                        // Конец воров
+    alignas(64) std::atomic<std::int64_t> bottom_;                     // Конец владельца
+    std::atomic<Array*> array_;
+    std::vector<std::unique_ptr<Array>> arrays_;                       // Все массивы (меняет только владелец)
+};
+
+class TaskGroup;
+
+// Задача пула: функция и группа, которая её ждёт
+struct PoolTask {
+    std::function<void()> body;
+    TaskGroup* group;
+};
+
+class ThreadPool {
+public:
+    // threads — общее число исполнителей вместе с потоком, вызывающим sync (рабочих потоков threads - 1)
+    explicit ThreadPool(int threads = omp_get_max_threads()) : size_(threads < 1 ? 1 : threads) {
+        for (int w = 0; w + 1 < size_; ++w) deques_.push_back(std::unique_ptr<WorkStealingDeque<PoolTask*>>(new WorkStealingDeque<PoolTask*>()));
+        for (int w = 0; w + 1 < size_; ++w) workers_.push_back(std::thread(&ThreadPool::workerLoop, this, w));
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(parkMutex_);
+            stop_ = true;
+            epoch_++;
+        }
+        parkCondition_.notify_all();
+        for (std::thread& t : workers_) t.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Число исполнителей (рабочие потоки + ожидающий поток)
+    int size() const { return size_; }
+
+    // Общий пул программы: размер — omp_get_max_threads() при первом обращении
+    static ThreadPool& global() {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    // Параллельный цикл: body(begin, end) для кусков не больше grain элементов
+    template <typename Body>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Body body);
+
+    // Параллельная редукция: map(begin, end) -> R для кусков, combine(R, R) -> R; identity для пустого диапазона
+    template <typename R, typename Map, typename Combine>
+    R parallelReduce(std::size_t begin, std::size_t end, std::size_t grain, R identity, Map map, Combine combine);
+
+private:
+    friend class TaskGroup;
+
+    // Номер рабочего потока этого пула для текущего потока (-1 — поток вне пула)
+    int workerIndex() const {
+        return currentPool() == this ? currentWorker() : -1;
+    }
+
+    static const ThreadPool*& currentPool() {
+        thread_local const ThreadPool* pool = nullptr;
+        return pool;
+    }
+
+    static int& currentWorker() {
+        thread_local int worker = -1;
+        return worker;
+    }
+
+    void submit(PoolTask* task) {
+        int self = workerIndex();
+        if (self >= 0) {
+            deques_[self]->push(task);                                 // Своя дека — без блокировок
+        } else {
+            std::lock_guard<std::mutex> lock(injectMutex_);
+            injected_.push_back(task);
+            injectedCount_.fetch_add(1, std::memory_order_seq_cst);
+        }
+        // Публикация задачи (push в деку — release-запись) не должна переупорядочиться с чтением sleeping_:
+        // иначе поток может припарковаться, не увидев задачу, а мы — не увидеть его среди спящих
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_seq_cst) > 0) {           // Будим спящий поток
+            {
+                std::lock_guard<std::mutex> lock(parkMutex_);
+                epoch_++;
+            }
+            parkCondition_.notify_one();
+        }
+    }
+
+    // Поиск задачи: своя дека, общая очередь, кража у других (начиная со случайного)
+    PoolTask* findTask(int self) {
+        PoolTask* task = nullptr;
+        if (self >= 0 && deques_[self]->pop(task)) return task;
+        if (injectedCount_.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(injectMutex_);
+            if (!injected_.empty()) {
+                task = injected_.front();
+                injected_.pop_front();
+                injectedCount_.fetch_sub(1, std::memory_order_relaxed);
+                return task;
+            }
+        }
+        std::size_t count = deques_.size();
+        if (count == 0) return nullptr;
+        thread_local unsigned int seed = 0x9E3779B9u;
+        seed = seed * 1664525u + 1013904223u;                          // Случайная первая жертва
+        std::size_t first = seed % count;
+        for (std::size_t k = 0; k < count; ++k) {
+            std::size_t victim = (first + k) % count;
+            if (static_cast<int>(victim) == self) continue;
+            if (deques_[victim]->steal(task)) return task;
+        }
+        return nullptr;
+    }
+
+    inline void execute(PoolTask* task);
+
+    void workerLoop(int self) {
+        currentPool() = this;
+        currentWorker() = self;
+        while (true) {
+            PoolTask* task = nullptr;
+            for (int spin = 0; spin < POOL_SPIN_ROUNDS && !task; ++spin) {
+                task = findTask(self);
+                if (!task) std::this_thread::yield();
+            }
+            if (task) {
+                execute(task);
+                continue;
+            }
+
+            // Парковка: сначала объявляем себя спящим, затем последний раз ищем работу —
+            // submit после этого увидит sleeping_ > 0 и разбудит
+            sleeping_.fetch_add(1, std::memory_order_seq_cst);
+            unsigned long long seen;
+            {
+                std::lock_guard<std::mutex> lock(parkMutex_);
+                seen = epoch_;
+            }
+            task = findTask(self);
+            if (task) {
+                sleeping_.fetch_sub(1, std::memory_order_seq_cst);
+                execute(task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(parkMutex_);
+            parkCondition_.wait(lock, [&] { return stop_ || epoch_ != seen; });
+            sleeping_.fetch_sub(1, std::memory_order_seq_cst);
+            if (stop_) return;
+        }
+    }
+
+    int size_;
+    std::vector<std::unique_ptr<WorkStealingDeque<PoolTask*>>> deques_;
+    std::vector<std::thread> workers_;
+
+    std::mutex injectMutex_;                                           // Общая очередь для потоков вне пула
+    std::deque<PoolTask*> injected_;
+    std::atomic<int> injectedCount_{0};
+
+    std::mutex parkMutex_;                                             // Парковка
+    std::condition_variable parkCondition_;
+    unsigned long long epoch_ = 0;                                     // Меняется при каждом пробуждении
+    bool stop_ = false;
+    std::atomic<int> sleeping_{0};
+};
+
+// Группа задач: spawn порождает, sync ждёт все порождённые (выполняя задачи пула, пока ждёт)
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool& pool = ThreadPool::global()) : pool_(pool) {}
+    ~TaskGroup() { sync(); }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    template <typename F>
+    void spawn(F f) {
+        if (pool_.size() == 1) {                                       // Пул из одного потока — сразу
+            f();
+            return;
+        }
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        pool_.submit(new PoolTask{std::function<void()>(std::move(f)), this});
+    }
+
+    void sync() {
+        int self = pool_.workerIndex();
+        while (pending_.load(std::memory_order_acquire) != 0) {
+            PoolTask* task = pool_.findTask(self);
+            if (task) pool_.execute(task);
+            else std::this_thread::yield();
+        }
+    }
+
+private:
+    friend class ThreadPool;
+    ThreadPool& pool_;
+    std::atomic<int> pending_{0};
+};
+
+inline void ThreadPool::execute(PoolTask* task) {
+    task->body();
+    TaskGroup* group = task->group;
+    delete task;
+    group->pending_.fetch_sub(1, std::memory_order_release);          // Результаты задачи видны после sync
+}
+
+template <typename Body>
+void ThreadPool::parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Body body) {
+    if (grain < 1) grain = 1;
+    TaskGroup group(*this);
+    while (end - begin > grain) {                                      // Правые половины — задачам, левая — себе
+        std::size_t mid = begin + (end - begin) / 2;
+        group.spawn([this, mid, end, grain, body] { parallelFor(mid, end, grain, body); });
+        end = mid;
+    }
+    if (begin < end) body(begin, end);
+    group.sync();
+}
+
+template <typename R, typename Map, typename Combine>
+R ThreadPool::parallelReduce(std::size_t begin, std::size_t end, std::size_t grain, R identity, Map map, Combine combine) {
+    if (begin >= end) return identity;
+    if (grain < 1) grain = 1;
+    if (end - begin <= grain) return map(begin, end);
+    std::size_t mid = begin + (end - begin) / 2;
+    R right = identity;
+    TaskGroup group(*this);
+    group.spawn([&] { right = parallelReduce(mid, end, grain, identity, map, combine); });
+    R left = parallelReduce(begin, mid, grain, identity, map, combine);
+    group.sync();
+    return combine(left, right);
+}
@@ -0,0 +1,116 @@
+// Общая библиотека: топология машины — узлы NUMA, ядра и кэши
+// На многосокетных машинах память и ядра разбиты на узлы NUMA: обращение к памяти своего узла быстрее.
+// Здесь — только определение топологии (Linux: /sys/devices/system/node и /sys/devices/system/cpu/cpu0/cache);
+// на других системах и без sysfs считается, что узел один, а размеры кэшей неизвестны.
+
+#pragma once
+
+#include <cstddef>       // Для size_t
+#include <vector>        // Для списков ядер, узлов и кэшей
+#include <string>        // Для путей sysfs
+#include <fstream>       // Для чтения sysfs
+#include <sstream>       // Для разбора списков
+#ifdef __linux__
+#include <sched.h>       // Для sched_getcpu
+#endif
+
+// Разбор списка вида "0-3,8-11" (формат sysfs)
+inline std::vector<int> parseCpuList(const std::string& list) {
+    std::vector<int> ids;
+    std::istringstream in(list);
+    std::string part;
+    while (std::getline(in, part, ',')) {
+        if (part.empty() || part[0] < '0' || part[0] > '9') continue;
+        std::size_t dash = part.find('-');
+        int first = std::stoi(part.substr(0, dash));
+        int last = dash == std::string::npos ? first : std::stoi(part.substr(dash + 1));
+        for (int id = first; id <= last; ++id) ids.push_back(id);
+    }
+    return ids;
+}
+
+// Узел NUMA каждого ядра (индекс — номер ядра); вычисляется один раз
+inline const std::vector<int>& cpuNodeMap() {
+    static const std::vector<int> map = [] {
+        std::vector<int> nodeOf;
+        std::ifstream online("/sys/devices/system/node/online");
+        std::string line;
+        if (!std::getline(online, line)) return nodeOf;                // Нет sysfs — один узел
+        for (int node : parseCpuList(line)) {
+            std::ifstream cpus("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+            std::string list;
+            if (!std::getline(cpus, list)) continue;
+            for (int cpu : parseCpuList(list)) {
+                if (cpu >= static_cast<int>(nodeOf.size())) nodeOf.resize(cpu + 1, 0);
+                nodeOf[cpu] = node;
+            }
+        }
+        return nodeOf;
+    }();
+    return map;
+}
+
+// Количество узлов NUMA (наибольший номер узла + 1, не меньше 1)
+inline int numaNodeCount() {
+    int count = 1;
+    for (int node : cpuNodeMap()) {
+        if (node + 1 > count) count = node + 1;
+    }
+    return count;
+}
+
+// Кэш данных одного уровня
+struct CacheLevel {
+    int level = 0;                     // 1, 2, 3
+    std::size_t bytes = 0;             // Размер (L1, L2 — на ядро, L3 — обычно общий)
+};
+
+// Разбор размера кэша sysfs ("48K", "2048K", "105M")
+inline std::size_t parseCacheSize(const std::string& text) {
+    std::size_t value = 0, i = 0;
+    while (i < text.size() && text[i] >= '0' && text[i] <= '9') value = value * 10 + (text[i++] - '0');
+    if (i < text.size() && (text[i] == 'K' || text[i] == 'k')) value <<= 10;
+    else if (i < text.size() && (text[i] == 'M' || text[i] == 'm')) value <<= 20;
+    return value;
+}
+
+// Кэши данных ядра 0 по возрастанию уровня (кэши команд пропускаются); пусто — неизвестно
+inline std::vector<CacheLevel> dataCacheLevels() {
+    std::vector<CacheLevel> levels;
+    for (int index = 0;; ++index) {
+        std::string dir = "/sys/devices/system/cpu/cpu0/cache/index" + std::to_string(index) + "/";
+        std::ifstream levelFile(dir + "level"), typeFile(dir + "type"), sizeFile(dir + "size");
+        std::string level, type, size;
+        if (!std::getline(levelFile, level) || !std::getline(typeFile, type) || !std::getline(sizeFile, size)) break;
+        if (type == "Instruction") continue;
+        CacheLevel c;
+        c.level = std::stoi(level);
+        c.bytes = parseCacheSize(size);
+        levels.push_back(c);
+    }
+    return levels;
+}
+
+// Уровень памяти, в который помещается рабочий набор: "L1", "L2", "L3" или "DRAM"
+inline std::string memoryLevelName(std::size_t bytes, const std::vector<CacheLevel>& levels) {
+    for (const CacheLevel& c : levels) {
+        if (bytes <= c.bytes) return "L" + std::to_string(c.level);
+    }
+    return "DRAM";
+}
+
+// Ядро, на котором сейчас выполняется поток (-1 — неизвестно)
+inline int currentCpu() {
+#ifdef __linux__
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+// Узел NUMA текущего потока (0, если неизвестно)
+inline int currentNumaNode() {
+    int cpu = currentCpu();
+    const std::vector<int>& map = cpuNodeMap();
+    return cpu < 0 || cpu >= static_cast<int>(map.size()) ? 0 : map[cpu];
+}
@@ -7,9 +7,10 @@
 
 
 #include <iostream>   // Для работы с вводом/выводом (cout, cin, endl)
-#include <random>     // Для генерации случайных чисел (random_device, mt19937, uniform_int_distribution)
 #include <omp.h>      // Для параллельных вычислений OpenMP
 #include <chrono>     // Для измерения времени выполнения
+#include "../Common/reduction.h"   // Общая библиотека параллельных редукций
+#include "../Common/data_generator.h"  // Параллельная генерация массивов (счётчиковый генератор)
 
 using namespace std;  // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
 
@@ -31,18 +32,12 @@ int main() {                        // Основная функция
     int* arr = new int[N];           // int* - указатель на int
                                      // new int[SIZE] - выделяем память   
 
-    // Настройка генератора случайных чисел
-    random_device rd;                // random_device используется как источник случайности
-    mt19937 gen(rd());               // mt19937 — генератор случайных чисел Mersenne Twister
-                                     // Инициализируем его значением из rd(), чтобы последовательность была случайной
-   
-    uniform_int_distribution<int> dist(1, 100);    // uniform_int_distribution задаёт равномерное распределение чисел от 1 до 1000000
-                                                   // dist(gen) будет возвращать случайное число из этого диапазона
+    // Заполнение массива случайными числами (Common/data_generator.h)
+    generateArray(arr, N, Distribution::Uniform, 1, 100); // Равномерное распределение чисел от 1 до 100
+                                                          // Потоки заполняют свои куски независимо, зерно фиксировано
 
-    // Заполнение массива случайными числами
     cout << "Массив: ";
     for (int i = 0; i < N; i++) {    // Цикл проходит по всем элементам массива
-        arr[i] = dist(gen);          // Генерируем случайное число (в нашем случае 0т 1 до 100) и записываем его в массив
         cout << arr[i] << " ";       // Выводим элемент массива
     }
     cout << endl;                    // Переход на новую строку
@@ -61,18 +56,13 @@ int main() {                        // Основная функция
     // ПАРАЛЛЕЛЬНОЕ ВЫЧИСЛЕНИЕ 
     auto start_par = chrono::high_resolution_clock::now();  // Начало замера времени
 
-    double sum_par = 0;             // Общая сумма (будет использоваться в reduction)
+    // Редукция из общей библиотеки (Common/reduction.h):
+             // - каждый поток суммирует свою часть в 64-битное целое (без ошибок округления double)
+             // - частичные суммы лежат в отдельных кэш-линиях
+             // - в конце суммы потоков складываются
+    long long sum_par = parallelSum(arr, N);
 
-    #pragma omp parallel for reduction(+:sum_par)      // Цикл выполняется в нескольких потоках
-    // OpenMP:
-             // - цикл выполняется параллельно
-             // - каждый поток имеет свою локальную sum_par
-             // - в конце OpenMP складывает все суммы
-    for (int i = 0; i < N; i++) {   // Цикл распределяется между потоками
-        sum_par += arr[i];          // Каждый поток считает свою часть суммы
-    }
-
-    double avg_par = sum_par / N;   // Вычисляем среднее значение
+    double avg_par = static_cast<double>(sum_par) / N;   // Вычисляем среднее значение
 
     auto end_par = chrono::high_resolution_clock::now();                  // Конец замера времени
     chrono::duration<double, milli> duration_par = end_par - start_par;   // Вычисляем длительность параллельного алгоритма
@@ -7,56 +7,32 @@
 #include <algorithm>     // Для функции swap
 #include <omp.h>         // Для параллельных вычислений OpenMP
 #include <chrono>        // Для измерения времени выполнения
-#include <random>        // Для генерации случайных чисел (random_device, mt19937, uniform_int_distribution) 
+#include "../Common/data_generator.h"  // Параллельная генерация массивов (счётчиковый генератор) 
+#include "../Common/parallel_sort.h"   // Параллельные сортировки O(n log n): слиянием и выборкой (samplesort)
+#include "../Common/selection_sort.h"  // Параллельная сортировка выбором с постоянной командой потоков
+#include "../Common/odd_even_sort.h"   // Блочная чётно-нечётная сортировка (замена гоночного bubbleSortParallel)
+#include "../Common/arena.h"           // Буфер замеров: вход восстанавливается перед каждой сортировкой вместо копий
 
 using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.   
 
 // Пузырьком с OpenMP (BUBBLE SORT)
-void bubbleSortParallel(vector<int>& arr) {    // Функция принимает массив по ссылке, чтобы менять его прямо
-    int n = arr.size();                        // Определяем размер массива
-    for (int i = 0; i < n - 1; i++) {          // Внешний цикл: количество проходов по массиву
-                                               // Параллельное выполнение внутреннего цикла
-        #pragma omp parallel for               // Директива OpenMP: распределяем цикл по потокам
-        for (int j = 0; j < n - i - 1; j++) {  // Внутренний цикл сравнения соседних элементов
-            if (arr[j] > arr[j + 1]) {         // Если текущий элемент больше следующего
-                swap(arr[j], arr[j + 1]);      // Меняем их местами с помощью встроенной функции swap
-            }
-        }
-    }
+void bubbleSortParallel(int* arr, int n) {     // Функция принимает указатель на массив и его размер
+    oddEvenSortParallel(arr, n);                 // Чётно-нечётная сортировка перестановками (Common/odd_even_sort.h):
+                                                 // старый parallel for по j менял пересекающиеся пары (гонка данных);
+                                                 // здесь блоки потоков сортируются локально, затем соседние блоки
+                                                 // обмениваются половинами (merge-split) в фазах, разделённых барьерами
 }
 
 // Сортировка выбором с OpenMP (SELECTION SORT)
-void selectionSortParallel(vector<int>& arr) {  // Функция принимает массив по ссылке, чтобы менять его прямо
-    int n = arr.size();                         // Определяем размер массива
-    for (int i = 0; i < n - 1; i++) {           // Внешний цикл: выбираем позицию для минимального элемента
-        int minIndex = i;                       // Изначально считаем минимальным текущий элемент
-
-        #pragma omp parallel                    // Создаём параллельный регион
-        {
-            int localMin = minIndex;            // Каждый поток имеет свою копию локального минимума
-
-            #pragma omp for nowait              // Распределяем цикл поиска минимума по потокам без ожидания
-            for (int j = i + 1; j < n; j++) {   // Ищем минимальный элемент в оставшейся части массива
-                if (arr[j] < arr[localMin]) {   // Если нашли элемент меньше локального минимума
-                    localMin = j;               // Обновляем локальный минимум
-                }
-            }
-
-            #pragma omp critical                // Критическая секция: только один поток обновляет глобальный минимум
-            {
-                if (arr[localMin] < arr[minIndex]) {
-                    minIndex = localMin;        // Обновляем глобальный индекс минимального элемента
-                }
-            }
-        }
-        swap(arr[i], arr[minIndex]);            // Меняем текущий элемент с найденным минимальным
-    }
+void selectionSortParallel(int* arr, int n) {   // Функция принимает указатель на массив и его размер
+    selectionSortTeam(arr, n);                      // Одна команда потоков на всю сортировку (Common/selection_sort.h):
+                                                    // argmin в ячейках потоков без critical, обмен без второго барьера,
+                                                    // маленький остаток — последовательно
 }
 
 
 // Сортировка вставкой (последовательная, так как трудно распараллелить) INSERTION SORT
-void insertionSort(vector<int>& arr) {          // Функция принимает массив по ссылке, чтобы менять его прямо
-    int n = arr.size();                         // Определяем размер массива
+void insertionSort(int* arr, int n) {           // Функция принимает указатель на массив и его размер
     for (int i = 1; i < n; i++) {               // Проходим по массиву начиная со второго элемента
         int key = arr[i];                       // Сохраняем текущий элемент
         int j = i - 1;                          // Начинаем проверку отсортированной части слева
@@ -70,21 +46,10 @@ void insertionSort(vector<int>& arr) {          // Функция принима
     }
 }
 
-// Настройка генератора случайных чисел
-vector<int> generateRandomArray(int size) {
-    vector<int> arr(size);
-
-    random_device rd;                             // random_device используется как источник случайности
-    mt19937 gen(rd());                            // mt19937 — генератор случайных чисел Mersenne Twister
-                                                  // Инициализируем его значением из rd(), чтобы последовательность была случайной
-    uniform_int_distribution<int> dist(0, 99999); // uniform_int_distribution задаёт равномерное распределение чисел от 0 до 999999
-                                                  // dist(gen) будет возвращать случайное число из этого диапазона
-
-    // Заполнение массива случайными числами
-    for (int i = 0; i < size; i++) {
-        arr[i] = dist(gen);                       // Для каждого индекса i от 0 до SIZE-1 генерируем случайное число dist(gen) и записываем его в массив
-    }
-    return arr;
+// Генерация случайного массива (Common/data_generator.h): параллельно и с фиксированным зерном,
+// поэтому все сортировки в каждом запуске получают одни и те же данные
+vector<int> generateRandomArray(int size, Distribution dist = Distribution::Uniform) {
+    return generateArray(size, dist, 0, 99999);   // Равномерное распределение чисел от 0 до 99999 (или другое dist)
 }
 
 
@@ -95,31 +60,47 @@ int main() {                          // Основная функция
     for (int size : sizes) {                                 // Для каждого размера массива
         cout << "Массив размера: " << size << endl;
 
-        vector<int> data = generateRandomArray(size);        // Генерируем случайный массив
+        BenchmarkBuffer<int> buffer(generateRandomArray(size)); // Вход и рабочий массив (Common/arena.h)
 
         // BUBBLE SORT
-        vector<int> bubbleArr = data;                        // Создаём копию массива для пузырька
+        buffer.reset();                                      // Рабочий массив снова равен входу (вне замера)
         auto start = chrono::high_resolution_clock::now();   // Начала замера времени
-        bubbleSortParallel(bubbleArr);                       // Вызываем параллельную сортировку пузырьком
+        bubbleSortParallel(buffer.data(), size);             // Вызываем параллельную сортировку пузырьком
         auto end = chrono::high_resolution_clock::now();     // Конец замера времени
         chrono::duration<double> duration = end - start;     // Вычисляем длительность
         cout << "Bubble Sort Parallel: " << duration.count() << " s" << endl; // Выводим время
 
         // SELECTION SORT
-        vector<int> selectionArr = data;                     // Копия массива для сортировки выбором
+        buffer.reset();                                      // Рабочий массив снова равен входу (вне замера)
         start = chrono::high_resolution_clock::now();        // Начала замера времени
-        selectionSortParallel(selectionArr);                 // Параллельная сортировка выбором
+        selectionSortParallel(buffer.data(), size);          // Параллельная сортировка выбором
         end = chrono::high_resolution_clock::now();          // Конец замера времени
         duration = end - start;                              // Вычисляем длительность
         cout << "Selection Sort Parallel: " << duration.count() << " s" << endl;
 
         // INSERTION SORT (последовательная) 
-        vector<int> insertionArr = data;                     // Копия массива для сортировки вставкой
+        buffer.reset();                                      // Рабочий массив снова равен входу (вне замера)
         start = chrono::high_resolution_clock::now();        // Начала замера времени
-        insertionSort(insertionArr);                         // Последовательная сортировка вставкой
+        insertionSort(buffer.data(), size);                  // Последовательная сортировка вставкой
         end = chrono::high_resolution_clock::now();          // Конец замера времени
         duration = end - start;                              // Вычисляем длительность
         cout << "Insertion Sort: " << duration.count() << " s" << endl;
+
+        // MERGE SORT (параллельная, задачи OpenMP)
+        buffer.reset();                                      // Рабочий массив снова равен входу (вне замера)
+        start = chrono::high_resolution_clock::now();        // Начала замера времени
+        parallelMergeSort(buffer.data(), buffer.size());     // Параллельная сортировка слиянием
+        end = chrono::high_resolution_clock::now();          // Конец замера времени
+        duration = end - start;                              // Вычисляем длительность
+        cout << "Merge Sort Parallel: " << duration.count() << " s" << endl;
+
+        // SAMPLE SORT (параллельная сортировка выборкой)
+        buffer.reset();                                      // Рабочий массив снова равен входу (вне замера)
+        start = chrono::high_resolution_clock::now();        // Начала замера времени
+        parallelSampleSort(buffer.data(), buffer.size());    // Параллельная сортировка выборкой
+        end = chrono::high_resolution_clock::now();          // Конец замера времени
+        duration = end - start;                              // Вычисляем длительность
+        cout << "Sample Sort Parallel: " << duration.count() << " s" << endl;
     }
 
     return 0;                                                // Завершаем программу
@@ -4,16 +4,20 @@
 
 #include <iostream>      // Для работы с вводом/выводом (cout, cin, endl)
 #include <vector>        // Для использования динамического массива vector
-#include <algorithm>     // Для функции swap
+#include <algorithm>     // Для функций swap, sort и equal
 #include <omp.h>         // Для параллельных вычислений OpenMP
 #include <chrono>        // Для измерения времени выполнения
-#include <random>        // Для генерации случайных чисел (random_device, mt19937, uniform_int_distribution)
+#include "../Common/data_generator.h"  // Параллельная генерация массивов (счётчиковый генератор)
+#include "../Common/parallel_sort.h"   // Параллельные сортировки O(n log n): слиянием и выборкой (samplesort)
+#include "../Common/radix_sort.h"      // Параллельная поразрядная сортировка (LSD radix sort) для int
+#include "../Common/selection_sort.h"  // Параллельная сортировка выбором с постоянной командой потоков
+#include "../Common/odd_even_sort.h"   // Блочная чётно-нечётная сортировка (замена гоночного bubbleSortParallel)
+#include "../Common/arena.h"           // Буфер замеров: вход восстанавливается перед каждой сортировкой вместо копий
 
 using namespace std;     // Стандартное пространство имён, чтобы не писать std:: перед cout, endl и т.д.
 
 // Последовательная сортировка пузырьком (BUBBLE SORT)
-void bubbleSort(vector<int>& arr) {              // Функция принимает массив по ссылке, чтобы менять его прямо
-    int n = arr.size();                          // Определяем размер массива
+void bubbleSort(int* arr, int n) {               // Функция принимает указатель на массив и его размер
     for (int i = 0; i < n - 1; i++) {            // Внешний цикл: количество проходов по массиву
         for (int j = 0; j < n - i - 1; j++) {    // Внутренний цикл: сравниваем соседние элементы
             if (arr[j] > arr[j + 1]) {           // Если текущий элемент больше следующего
@@ -25,23 +29,16 @@ void bubbleSort(vector<int>& arr) {              // Функция приним
 
 
 // Пузырьком с OpenMP (параллельная версия)
-void bubbleSortParallel(vector<int>& arr) {      // Функция принимает массив по ссылке, чтобы менять его прямо
-    int n = arr.size();                          // Определяем размер массива
-    for (int i = 0; i < n - 1; i++) {            // Внешний цикл: количество проходов
-                                                 // Параллельное выполнение внутреннего цикла
-        #pragma omp parallel for                 // Директива OpenMP: распределяем итерации по потокам
-        for (int j = 0; j < n - i - 1; j++) {    // Внутренний цикл: сравнение соседних элементов
-            if (arr[j] > arr[j + 1]) {           // Если текущий элемент больше следующего
-                swap(arr[j], arr[j + 1]);        // Меняем элементы местами с помощью встроенной функции swap
-            }
-        }
-    }
+void bubbleSortParallel(int* arr, int n) {       // Функция принимает указатель на массив и его размер
+    oddEvenSortParallel(arr, n);                 // Чётно-нечётная сортировка перестановками (Common/odd_even_sort.h):
+                                                 // старый parallel for по j менял пересекающиеся пары (гонка данных);
+                                                 // здесь блоки потоков сортируются локально, затем соседние блоки
+                                                 // обмениваются половинами (merge-split) в фазах, разделённых барьерами
 }
 
 
 // Последовательная сортировка выбором (SELECTION SORT)
-void selectionSort(vector<int>& arr) {           // Функция принимает массив по ссылке, чтобы менять его прямо
-    int n = arr.size();                          // Определяем размер массива
+void selectionSort(int* arr, int n) {            // Функция принимает указатель на массив и его размер
     for (int i = 0; i < n - 1; i++) {            // Внешний цикл: выбираем позицию для минимального элемента
         int minIndex = i;                        // Изначально минимальный элемент — текущий
         for (int j = i + 1; j < n; j++) {        // Внутренний цикл: ищем минимальный элемент в оставшейся части массива
@@ -55,36 +52,14 @@ void selectionSort(vector<int>& arr) {           // Функция приним
 
 
 // Сортировка выбором с OpenMP (частичная параллельность)
-void selectionSortParallel(vector<int>& arr) {   // Функция принимает массив по ссылке, чтобы менять его прямо
-    int n = arr.size();                          // Определяем размер массива
-    for (int i = 0; i < n - 1; i++) {            // Внешний цикл: выбираем позицию для минимального элемента
-        int minIndex = i;                        // Изначально минимальный элемент — текущий
-
-        #pragma omp parallel                     // Создаём параллельный регион
-        {
-            int localMin = minIndex;             // Каждый поток имеет свою копию локального минимума
-
-            #pragma omp for nowait               // Распределяем цикл поиска минимума по потокам без ожидания
-            for (int j = i + 1; j < n; j++) {    // Ищем минимальный элемент в оставшейся части массива
-                if (arr[j] < arr[localMin]) {    // Если нашли элемент меньше локального минимума
-                    localMin = j;                // Обновляем локальный минимум
-                }
-            }
-
-            #pragma omp critical            // Критическая секция: только один поток обновляет глобальный минимум
-            {
-                if (arr[localMin] < arr[minIndex]) {
-                    minIndex = localMin;    // Обновляем глобальный индекс минимального элемента
-                }
-            }
-        }
-        swap(arr[i], arr[minIndex]);        // Меняем текущий элемент с найденным минимальным
-    }
+void selectionSortParallel(int* arr, int n) {    // Функция принимает указатель на массив и его размер
+    selectionSortTeam(arr, n);                      // Одна команда потоков на всю сортировку (Common/selection_sort.h):
+                                                    // argmin в ячейках потоков без critical, обмен без второго барьера,
+                                                    // маленький остаток — последовательно
 }
 
 // Последовательная сортировка вставкой (INSERTION SORT)
-void insertionSort(vector<int>& arr) {       // Функция принимает массив по ссылке, чтобы менять его прямо
-    int n = arr.size();                      // Определяем размер массива
+void insertionSort(int* arr, int n) {        // Функция принимает указатель на массив и его размер
     for (int i = 1; i < n; i++) {            // Проходим по массиву начиная со второго элемента
         int key = arr[i];                    // Сохраняем текущий элемент
         int j = i - 1;                       // Начинаем проверку отсортированной части слева
@@ -97,21 +72,10 @@ void insertionSort(vector<int>& arr) {       // Функция принимае
     }
 }
 
-// Настройка генератора случайных чисел
-vector<int> generateRandomArray(int size) {
-    vector<int> arr(size);                  
-
-    random_device rd;                             // random_device используется как источник случайности
-    mt19937 gen(rd());                            // mt19937 — генератор случайных чисел Mersenne Twister
-                                                  // Инициализируем его значением из rd(), чтобы последовательность была случайной
-    uniform_int_distribution<int> dist(0, 99999); // uniform_int_distribution задаёт равномерное распределение чисел от 0 до 999999
-                                                  // dist(gen) будет возвращать случайное число из этого диапазона
-
-    // Заполнение массива случайными числами                                              
-    for (int i = 0; i < size; i++) {
-        arr[i] = dist(gen);                       // Для каждого индекса i от 0 до SIZE-1 генерируем случайное число dist(gen) и записываем его в массив
-    }
-    return arr;                              
+// Генерация случайного массива (Common/data_generator.h): параллельно и с фиксированным зерном,
+// поэтому все сортировки в каждом запуске получают одни и те же данные
+vector<int> generateRandomArray(int size, Distribution dist = Distribution::Uniform) {
+    return generateArray(size, dist, 0, 99999);   // Равномерное распределение чисел от 0 до 99999 (или другое dist)
 }
 
 
@@ -122,48 +86,99 @@ int main() {                            // Основная функция
     for (int size : sizes) {                      // Для каждого размера массива
         cout << "Массив размера: " << size << endl;
 
-        vector<int> data = generateRandomArray(size); // Генерируем случайный массив
+        BenchmarkBuffer<int> buffer(generateRandomArray(size)); // Вход и рабочий массив (Common/arena.h)
 
         // Пузырьком (последовательная)
-        vector<int> bubbleArr = data;                       // Создаём копию массива для пузырька
+        buffer.reset();                                     // Рабочий массив снова равен входу (вне замера)
         auto start = chrono::high_resolution_clock::now();  // Начало замера времени
-        bubbleSort(bubbleArr);                              // Вызываем последовательную сортировку пузырьком
+        bubbleSort(buffer.data(), size);                    // Вызываем последовательную сортировку пузырьком
         auto end = chrono::high_resolution_clock::now();    // Конец замера времени
         chrono::duration<double> duration = end - start;    // Вычисляем продолжительность
         cout << "Bubble Sort Sequential: " << duration.count() << " s" << endl;
 
         // Пузырьком (параллельная)
-        vector<int> bubbleArrParallel = data;               // Копия массива для сортировки пузырька
+        buffer.reset();                                     // Рабочий массив снова равен входу (вне замера)
         start = chrono::high_resolution_clock::now();       // Начало замера времени
-        bubbleSortParallel(bubbleArrParallel);              // Вызываем параллельная сортировка пузырьком
+        bubbleSortParallel(buffer.data(), size);            // Вызываем параллельная сортировка пузырьком
         end = chrono::high_resolution_clock::now();         // Конец замера времени
         duration = end - start;                             // Вычисляем продолжительность
         cout << "Bubble Sort Parallel: " << duration.count() << " s" << endl;
 
         // Выбором (последовательная) 
-        vector<int> selectionArr = data;                    // Копия массива для сортировки выбором
+        buffer.reset();                                     // Рабочий массив снова равен входу (вне замера)
         start = chrono::high_resolution_clock::now();       // Начало замера времени
-        selectionSort(selectionArr);                        // Вызываем последовательную сортировку выбором
+        selectionSort(buffer.data(), size);                 // Вызываем последовательную сортировку выбором
         end = chrono::high_resolution_clock::now();         // Конец замера времени
         duration = end - start;                             // Вычисляем продолжительность
         cout << "Selection Sort Sequential: " << duration.count() << " s" << endl;
 
         // Выбором (параллельная)               
-        vector<int> selectionArrParallel = data;           // Копия массива для сортировки выбором
+        buffer.reset();                                    // Рабочий массив снова равен входу (вне замера)
         start = chrono::high_resolution_clock::now();      // Начало замера времени
-        selectionSortParallel(selectionArrParallel);       // Вызываем параллельная сортировка выбором
+        selectionSortParallel(buffer.data(), size);        // Вызываем параллельная сортировка выбором
         end = chrono::high_resolution_clock::now();        // Конец замера времени
         duration = end - start;                            // Вычисляем продолжительность
         cout << "Selection Sort Parallel: " << duration.count() << " s" << endl;
 
         // Вставкой (последовательная)             
-        vector<int> insertionArr = data;                   // Копия массива для сортировки вставкой
+        buffer.reset();                                    // Рабочий массив снова равен входу (вне замера)
         start = chrono::high_resolution_clock::now();      // Начало замера времени
-        insertionSort(insertionArr);                       // Вызываем последовательную сортировку вставкой
+        insertionSort(buffer.data(), size);                // Вызываем последовательную сортировку вставкой
         end = chrono::high_resolution_clock::now();        // Конец замера времени
         duration = end - start;                            // Вычисляем продолжительность
         cout << "Insertion Sort: " << duration.count() << " сек" << endl;
     }
 
+    // Большие массивы: O(n^2) сортировки здесь работают минутами, поэтому сравниваем только O(n log n) и поразрядную
+    vector<int> largeSizes = {1000000, 10000000};            // Размеры больших массивов
+    vector<Distribution> distributions = {                   // Распределения входных данных
+        Distribution::Uniform, Distribution::Sorted, Distribution::ReverseSorted,
+        Distribution::NearlySorted, Distribution::FewUnique
+    };
+
+    for (int size : largeSizes) {                            // Для каждого большого размера
+        for (Distribution dist : distributions) {            // И каждого распределения
+            cout << "Массив размера: " << size << ", распределение: " << distributionName(dist) << endl;
+
+            BenchmarkBuffer<int> buffer(generateRandomArray(size, dist)); // Вход и рабочий массив (Common/arena.h)
+
+            // std::sort (последовательная, эталон)
+            buffer.reset();                                      // Рабочий массив снова равен входу (вне замера)
+            auto start = chrono::high_resolution_clock::now();   // Начало замера времени
+            sort(buffer.begin(), buffer.end());                  // Стандартная сортировка
+            auto end = chrono::high_resolution_clock::now();     // Конец замера времени
+            chrono::duration<double> duration = end - start;     // Вычисляем продолжительность
+            cout << "std::sort Sequential: " << duration.count() << " s" << endl;
+            vector<int> stdArr(buffer.begin(), buffer.end());    // Эталон для проверки остальных сортировок (вне замера)
+
+            // Слиянием (параллельная, задачи OpenMP)
+            buffer.reset();                                      // Рабочий массив снова равен входу (вне замера)
+            start = chrono::high_resolution_clock::now();        // Начало замера времени
+            parallelMergeSort(buffer.data(), buffer.size());     // Параллельная сортировка слиянием
+            end = chrono::high_resolution_clock::now();          // Конец замера времени
+            duration = end - start;                              // Вычисляем продолжительность
+            cout << "Merge Sort Parallel: " << duration.count() << " s"
+                 << (equal(buffer.begin(), buffer.end(), stdArr.begin()) ? "" : " (ОШИБКА: массив не отсортирован)") << endl; // Проверка с эталоном
+
+            // Выборкой (параллельная, samplesort)
+            buffer.reset();                                      // Рабочий массив снова равен входу (вне замера)
+            start = chrono::high_resolution_clock::now();        // Начало замера времени
+            parallelSampleSort(buffer.data(), buffer.size());    // Параллельная сортировка выборкой
+            end = chrono::high_resolution_clock::now();          // Конец замера времени
+            duration = end - start;                              // Вычисляем продолжительность
+            cout << "Sample Sort Parallel: " << duration.count() << " s"
+                 << (equal(buffer.begin(), buffer.end(), stdArr.begin()) ? "" : " (ОШИБКА: массив не отсортирован)") << endl; // Проверка с эталоном
+
+            // Поразрядная (параллельная, без сравнений)
+            buffer.reset();                                      // Рабочий массив снова равен входу (вне замера)
+            start = chrono::high_resolution_clock::now();        // Начало замера времени
+            radixSortParallel(buffer.data(), buffer.size());     // Параллельная поразрядная сортировка
+            end = chrono::high_resolution_clock::now();          // Конец замера времени
+            duration = end - start;                              // Вычисляем продолжительность
+            cout << "Radix Sort Parallel: " << duration.count() << " s"
+                 << (equal(buffer.begin(), buffer.end(), stdArr.begin()) ? "" : " (ОШИБКА: массив не отсортирован)") << endl; // Проверка с эталоном
+        }
+    }
+
     return 0; // Завершаем программу
 }